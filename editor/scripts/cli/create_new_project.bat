@@ -155,16 +155,27 @@ echo Setting up default engine configurations...
 
 rem memory zones
 echo # Engine memory zones configuration >> "%PROJECT_PATH%\%PROJECT_NAME%\configs\engine.cfg"
+echo # format: ^<zone_name^> = ^<capacity^> [-^> ^<options^>], or ^<zone_name^> = ^<count^> x ^<slot_size^> for fixed-size pools >> "%PROJECT_PATH%\%PROJECT_NAME%\configs\engine.cfg"
+echo #   concurrent  -^> thread-safe allocations through per-thread caches >> "%PROJECT_PATH%\%PROJECT_NAME%\configs\engine.cfg"
+echo #   coalesce    -^> merge adjacent freed blocks (ignored on concurrent zones) >> "%PROJECT_PATH%\%PROJECT_NAME%\configs\engine.cfg"
+echo #   frame_arena -^> pointer-bump only, reset every frame (data survives exactly one frame) >> "%PROJECT_PATH%\%PROJECT_NAME%\configs\engine.cfg"
+echo #   stack       -^> LIFO scratch memory released by rolling back to a marker >> "%PROJECT_PATH%\%PROJECT_NAME%\configs\engine.cfg"
+echo #   reserve     -^> reserve address space up front, commit pages on first use >> "%PROJECT_PATH%\%PROJECT_NAME%\configs\engine.cfg"
+echo #   hugepages   -^> reserve backed by 2MB pages where the OS allows (implies reserve) >> "%PROJECT_PATH%\%PROJECT_NAME%\configs\engine.cfg"
+echo #   grow[:max]  -^> chain extra chunks once full, optionally capped at a total capacity (general zones only) >> "%PROJECT_PATH%\%PROJECT_NAME%\configs\engine.cfg"
 echo [memory_zones] >> "%PROJECT_PATH%\%PROJECT_NAME%\configs\engine.cfg"
 echo core = "4KB" >> "%PROJECT_PATH%\%PROJECT_NAME%\configs\engine.cfg"
 echo modules = "4KB" >> "%PROJECT_PATH%\%PROJECT_NAME%\configs\engine.cfg"
-echo containers = "8MB" >> "%PROJECT_PATH%\%PROJECT_NAME%\configs\engine.cfg"
-echo strings = "8MB" >> "%PROJECT_PATH%\%PROJECT_NAME%\configs\engine.cfg"
+echo containers = "8MB" -^> grow:64MB >> "%PROJECT_PATH%\%PROJECT_NAME%\configs\engine.cfg"
+echo strings = "8MB" -^> grow:64MB >> "%PROJECT_PATH%\%PROJECT_NAME%\configs\engine.cfg"
 echo delegates = "8KB" >> "%PROJECT_PATH%\%PROJECT_NAME%\configs\engine.cfg"
 echo input = "4KB" >> "%PROJECT_PATH%\%PROJECT_NAME%\configs\engine.cfg"
 echo platform = "2KB" >> "%PROJECT_PATH%\%PROJECT_NAME%\configs\engine.cfg"
-echo assets = "256MB" >> "%PROJECT_PATH%\%PROJECT_NAME%\configs\engine.cfg"
+echo assets = "256MB" -^> hugepages >> "%PROJECT_PATH%\%PROJECT_NAME%\configs\engine.cfg"
 echo renderer = "64MB" >> "%PROJECT_PATH%\%PROJECT_NAME%\configs\engine.cfg"
+echo frame = "4MB" -^> frame_arena >> "%PROJECT_PATH%\%PROJECT_NAME%\configs\engine.cfg"
+echo scratch = "4MB" -^> stack >> "%PROJECT_PATH%\%PROJECT_NAME%\configs\engine.cfg"
+echo delegate_handles = "512 x 16" >> "%PROJECT_PATH%\%PROJECT_NAME%\configs\engine.cfg"
 echo. >> "%PROJECT_PATH%\%PROJECT_NAME%\configs\engine.cfg"
 
 echo # Loggers configuration >> "%PROJECT_PATH%\%PROJECT_NAME%\configs\engine.cfg"
@@ -0,0 +1,236 @@
+// pushes a fixed number of 8-byte items through the spsc ring with one producer and one consumer, then
+// through the mpmc ring with as many consumers as producers, and checks every item arrives exactly once.
+// it links the ring and the memory zones it allocates from, so it brings up a small memory manager first
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "vytal/core/containers/ring/ring.h"
+#include "vytal/core/hal/clock/hires/hires.h"
+#include "vytal/core/memory/manager/memory_manager.h"
+#include "vytal/core/platform/filesystem/filesystem.h"
+#include "vytal/core/platform/thread/thread.h"
+#include "vytal/defines/shared.h"
+
+#define BENCH_ITEMS (1 << 24)
+#define BENCH_CAPACITY 1024
+#define BENCH_MAX_THREADS 8
+
+#define BENCH_CONFIG_FILENAME "ring_throughput_zones.txt"
+
+// the rings only allocate from the containers zone
+static ConstStr bench_config[] = {
+    "[memory_zones]",
+    "containers = \"1MB\"",
+    "[end]",
+};
+
+typedef struct Bench_Ring_State {
+    SpscRing _spsc;
+    MpmcRing _mpmc;
+    ByteSize _producers;
+    ByteSize _items;  // per producer
+
+    volatile Bool _gate;
+} BenchRingState;
+
+typedef struct Bench_Ring_Worker {
+    BenchRingState *_state;
+    ByteSize        _index;
+    UInt64          _sum;  // consumers only
+    ByteSize        _count;
+    Bool            _ordered;
+} BenchRingWorker;
+
+// items carry their producer in the top bits, so consumers can tell a lost or doubled one from a reordered one
+#define BENCH_ITEM(producer, sequence) (((UInt64)(producer) << 48) | (sequence))
+
+// ---------------------------------------------------------------------- //
+
+VYTAL_INLINE void _bench_wait_gate(BenchRingState *state) {
+    while (!__atomic_load_n(&state->_gate, __ATOMIC_ACQUIRE)) platform_thread_yield();
+}
+
+// a full or empty ring gives up the time slice, so the benchmark still makes progress on fewer cores than threads
+static void _bench_spsc_producer(VoidPtr worker) {
+    BenchRingWorker *worker_ = worker;
+    BenchRingState  *state_  = worker_->_state;
+
+    _bench_wait_gate(state_);
+
+    for (UInt64 i = 0; i < state_->_items; ++i)
+        while (container_spsc_ring_push(state_->_spsc, &i) != CONTAINER_SUCCESS) platform_thread_yield();
+}
+
+static void _bench_spsc_consumer(VoidPtr worker) {
+    BenchRingWorker *worker_ = worker;
+    BenchRingState  *state_  = worker_->_state;
+
+    _bench_wait_gate(state_);
+
+    worker_->_ordered = true;
+
+    for (UInt64 i = 0; i < state_->_items; ++i) {
+        UInt64 item_ = 0;
+        while (container_spsc_ring_pop(state_->_spsc, &item_) != CONTAINER_SUCCESS) platform_thread_yield();
+
+        if (item_ != i) worker_->_ordered = false;
+        worker_->_sum += item_;
+        ++worker_->_count;
+    }
+}
+
+static void _bench_mpmc_producer(VoidPtr worker) {
+    BenchRingWorker *worker_ = worker;
+    BenchRingState  *state_  = worker_->_state;
+
+    _bench_wait_gate(state_);
+
+    for (UInt64 i = 0; i < state_->_items; ++i) {
+        UInt64 item_ = BENCH_ITEM(worker_->_index, i);
+        while (container_mpmc_ring_push(state_->_mpmc, &item_) != CONTAINER_SUCCESS) platform_thread_yield();
+    }
+}
+
+// every consumer takes an even share of the items, whoever produced them; a single producer's items
+// must still come out of any one consumer in the order they went in
+static void _bench_mpmc_consumer(VoidPtr worker) {
+    BenchRingWorker *worker_ = worker;
+    BenchRingState  *state_  = worker_->_state;
+    UInt64           last_[BENCH_MAX_THREADS];
+
+    for (ByteSize i = 0; i < BENCH_MAX_THREADS; ++i) last_[i] = (UInt64)-1;
+
+    _bench_wait_gate(state_);
+
+    worker_->_ordered = true;
+
+    for (ByteSize i = 0; i < state_->_items; ++i) {
+        UInt64 item_ = 0;
+        while (container_mpmc_ring_pop(state_->_mpmc, &item_) != CONTAINER_SUCCESS) platform_thread_yield();
+
+        ByteSize producer_ = item_ >> 48;
+        UInt64   sequence_ = item_ & ((1ull << 48) - 1);
+
+        if ((producer_ >= state_->_producers) || ((last_[producer_] != (UInt64)-1) && (sequence_ <= last_[producer_])))
+            worker_->_ordered = false;
+        else
+            last_[producer_] = sequence_;
+
+        worker_->_sum += sequence_;
+        ++worker_->_count;
+    }
+}
+
+// ---------------------------------------------------------------------- //
+
+// starts every thread before opening the gate, so thread start-up stays out of the timing
+static Flt64 _bench_run(BenchRingState *state, BenchRingWorker *workers, const ByteSize count, PlatformThreadFunc producer, PlatformThreadFunc consumer) {
+    PlatformThread threads_[BENCH_MAX_THREADS * 2];
+    HiResClock     clock_;
+
+    state->_gate = false;
+
+    for (ByteSize i = 0; i < count * 2; ++i) {
+        workers[i] = (BenchRingWorker){._state = state, ._index = i % count};
+
+        if (platform_thread_create(&threads_[i], (i < count) ? producer : consumer, &workers[i]) != PLATFORM_THREAD_SUCCESS) {
+            fprintf(stderr, "could not start thread %zu\n", i);
+            exit(1);
+        }
+    }
+
+    clock_hires_init(&clock_);
+    __atomic_store_n(&state->_gate, true, __ATOMIC_RELEASE);
+
+    for (ByteSize i = 0; i < count * 2; ++i) platform_thread_join(&threads_[i]);
+
+    return clock_hires_elapsed_nanoseconds(&clock_);
+}
+
+static Bool _bench_check(BenchRingWorker *consumers, const ByteSize count, const ByteSize producers, const ByteSize items) {
+    UInt64   sum_   = 0;
+    ByteSize total_ = 0;
+
+    for (ByteSize i = 0; i < count; ++i) {
+        if (!consumers[i]._ordered) return false;
+
+        sum_ += consumers[i]._sum;
+        total_ += consumers[i]._count;
+    }
+
+    return (total_ == producers * items) && (sum_ == (UInt64)producers * ((UInt64)items * (items - 1) / 2));
+}
+
+static void _bench_report(ConstStr name, const ByteSize threads, const Flt64 elapsed_ns) {
+    printf("    %-5s %zu x %zu: %7.2f ns per item, %7.2f M items/s\n", name, threads, threads, elapsed_ns / BENCH_ITEMS, (BENCH_ITEMS * 1e3) / elapsed_ns);
+}
+
+static Bool _bench_startup(void) {
+    FILE *config_ = fopen(BENCH_CONFIG_FILENAME, "w");
+    if (!config_) return false;
+
+    for (ByteSize i = 0; i < sizeof(bench_config) / sizeof(bench_config[0]); ++i) fprintf(config_, "%s\n", bench_config[i]);
+    fclose(config_);
+
+    File file_ = {0};
+    if (platform_filesystem_open_file(&file_, BENCH_CONFIG_FILENAME, FILE_IO_MODE_READ, FILE_MODE_BINARY) != FILE_SUCCESS) return false;
+
+    // the manager reads from the line after the section header, like the engine hands it over
+    Char line_buffer_[LINE_BUFFER_MAX_SIZE];
+    Str  line_   = line_buffer_;
+    Bool result_ = (platform_filesystem_read_line(&file_, NULL, &line_) == FILE_SUCCESS) && (memory_manager_startup(&file_) == MEMORY_MANAGER_SUCCESS);
+
+    platform_filesystem_close_file(&file_);
+    remove(BENCH_CONFIG_FILENAME);
+
+    return result_;
+}
+
+int main(void) {
+    if (!_bench_startup()) {
+        fprintf(stderr, "memory manager startup failed\n");
+        return 1;
+    }
+
+    BenchRingState  state_ = {0};
+    BenchRingWorker workers_[BENCH_MAX_THREADS * 2];
+
+    if ((container_spsc_ring_construct(sizeof(UInt64), BENCH_CAPACITY, &state_._spsc) != CONTAINER_SUCCESS) ||
+        (container_mpmc_ring_construct(sizeof(UInt64), BENCH_CAPACITY, &state_._mpmc) != CONTAINER_SUCCESS)) {
+        fprintf(stderr, "ring construction failed\n");
+        return 1;
+    }
+
+    printf("ring throughput over %d items of 8 bytes, %d slots\n", BENCH_ITEMS, BENCH_CAPACITY);
+
+    state_._producers = 1;
+    state_._items     = BENCH_ITEMS;
+    Flt64 elapsed_ns_ = _bench_run(&state_, workers_, 1, _bench_spsc_producer, _bench_spsc_consumer);
+
+    if (!_bench_check(&workers_[1], 1, 1, BENCH_ITEMS)) {
+        fprintf(stderr, "spsc: items lost, doubled or reordered\n");
+        return 1;
+    }
+
+    _bench_report("spsc", 1, elapsed_ns_);
+
+    // the item count stays the same, split over the producers, so the timings compare directly
+    for (ByteSize threads = 1; threads <= BENCH_MAX_THREADS; threads *= 2) {
+        state_._producers = threads;
+        state_._items     = BENCH_ITEMS / threads;
+        elapsed_ns_       = _bench_run(&state_, workers_, threads, _bench_mpmc_producer, _bench_mpmc_consumer);
+
+        if (!_bench_check(&workers_[threads], threads, threads, BENCH_ITEMS / threads)) {
+            fprintf(stderr, "mpmc %zu x %zu: items lost, doubled or reordered\n", threads, threads);
+            return 1;
+        }
+
+        _bench_report("mpmc", threads, elapsed_ns_);
+    }
+
+    container_spsc_ring_destruct(state_._spsc);
+    container_mpmc_ring_destruct(state_._mpmc);
+    memory_manager_shutdown();
+
+    return 0;
+}
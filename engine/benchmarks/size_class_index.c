@@ -0,0 +1,192 @@
+// compares the golden-ratio size-class lookup the memory zones used to have against the
+// bit-length one they use now, over the same random mix of request sizes; both are copied
+// here as they are in the zone sources, so the benchmark builds without the engine
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "vytal/core/hal/clock/hires/hires.h"
+#include "vytal/defines/core/memory.h"
+#include "vytal/defines/shared.h"
+
+#define BENCH_CAPACITY MB_IN_BYTES(16)
+#define BENCH_NUM_SIZES (1 << 20)
+#define BENCH_ROUNDS 32
+
+// golden-ratio classes ------------------------------------------------- //
+
+static MemoryZoneSizeClass golden_classes[64];
+static ByteSize            golden_num_classes = 0;
+
+void _bench_golden_compute_size_classes(const ByteSize capacity) {
+    const Flt32 ratio_ = 1.618f;
+
+    ByteSize current_size_ = 4;
+    ByteSize index_        = 0;
+
+    for (; current_size_ <= capacity; ++index_) {
+        golden_classes[index_]._size = VYTAL_APPLY_ALIGNMENT(current_size_, MEMORY_ALIGNMENT_SIZE);
+        current_size_                = (ByteSize)((Flt32)current_size_ * ratio_);
+    }
+
+    golden_classes[index_]._size = capacity;
+    golden_num_classes           = ++index_;
+}
+
+VYTAL_INLINE ByteSize _bench_golden_log2_size(ByteSize size) {
+    ByteSize log2_ = 0;
+
+#if __x86_64__
+    if (size >= (1ull << 32)) {
+        size >>= 32;
+        log2_ += 32;
+    }
+#endif
+
+    if (size >= (1 << 16)) {
+        size >>= 16;
+        log2_ += 16;
+    }
+    if (size >= (1 << 8)) {
+        size >>= 8;
+        log2_ += 8;
+    }
+    if (size >= (1 << 4)) {
+        size >>= 4;
+        log2_ += 4;
+    }
+    if (size >= (1 << 2)) {
+        size >>= 2;
+        log2_ += 2;
+    }
+    if (size >= (1 << 1)) {
+        size >>= 1;
+        log2_ += 1;
+    }
+
+    return log2_;
+}
+
+VYTAL_NOINLINE ByteSize _bench_golden_index(const ByteSize size) {
+    const Flt32 log2_ratio_ = 0.694f;
+
+    ByteSize aligned_size_ = VYTAL_APPLY_ALIGNMENT(size, MEMORY_ALIGNMENT_SIZE);
+    ByteSize log2_size_    = _bench_golden_log2_size(aligned_size_);
+
+    ByteSize index_ = (ByteSize)((Flt32)log2_size_ / log2_ratio_);
+    if (index_ >= golden_num_classes) index_ = golden_num_classes - 1;
+
+    while (index_ + 1 < golden_num_classes && aligned_size_ > golden_classes[index_]._size) ++index_;
+    while (index_ > 0 && aligned_size_ <= golden_classes[index_ - 1]._size) --index_;
+
+    return index_;
+}
+
+// bit-length classes --------------------------------------------------- //
+
+#define SIZE_CLASS_GROUP ((ByteSize)1 << MEMORY_ZONE_SIZE_CLASS_GROUP_BITS)
+#define SIZE_CLASS_LG_QUANTUM _bench_floor_log2(MEMORY_ALIGNMENT_SIZE)
+
+static ByteSize bitlength_num_classes = 0;
+
+VYTAL_INLINE ByteSize _bench_floor_log2(const ByteSize value) {
+    return 63 - __builtin_clzll(value);
+}
+
+VYTAL_INLINE ByteSize _bench_bitlength_class_of(const ByteSize size) {
+    ByteSize value_ = size - 1;
+    ByteSize lg_    = _bench_floor_log2(value_ | ((ByteSize)1 << (SIZE_CLASS_LG_QUANTUM + MEMORY_ZONE_SIZE_CLASS_GROUP_BITS)));
+
+    return ((lg_ - SIZE_CLASS_LG_QUANTUM - MEMORY_ZONE_SIZE_CLASS_GROUP_BITS) << MEMORY_ZONE_SIZE_CLASS_GROUP_BITS) + (value_ >> (lg_ - MEMORY_ZONE_SIZE_CLASS_GROUP_BITS));
+}
+
+ByteSize _bench_bitlength_class_size(const ByteSize index) {
+    if (index < SIZE_CLASS_GROUP) return (index + 1) << SIZE_CLASS_LG_QUANTUM;
+
+    ByteSize doubling_ = (index >> MEMORY_ZONE_SIZE_CLASS_GROUP_BITS) - 1;
+    return (SIZE_CLASS_GROUP + (index & (SIZE_CLASS_GROUP - 1)) + 1) << (SIZE_CLASS_LG_QUANTUM + doubling_);
+}
+
+VYTAL_NOINLINE ByteSize _bench_bitlength_index(const ByteSize size) {
+    ByteSize index_ = _bench_bitlength_class_of(size);
+    return (index_ < bitlength_num_classes) ? index_ : bitlength_num_classes - 1;
+}
+
+// ---------------------------------------------------------------------- //
+
+// mostly small blocks with a long tail, roughly what containers and strings ask for
+static ByteSize *_bench_make_sizes(void) {
+    ByteSize *sizes_ = malloc(sizeof(ByteSize) * BENCH_NUM_SIZES);
+    if (!sizes_) return NULL;
+
+    UInt64 state_ = 0x9e3779b97f4a7c15ull;
+    for (ByteSize i = 0; i < BENCH_NUM_SIZES; ++i) {
+        state_ ^= state_ << 13;
+        state_ ^= state_ >> 7;
+        state_ ^= state_ << 17;
+
+        ByteSize limit_ = ((state_ & 7) == 0) ? BENCH_CAPACITY : ((state_ & 7) < 3) ? KB_IN_BYTES(64) : 1024;
+        sizes_[i]       = 1 + ((state_ >> 8) % limit_);
+    }
+
+    return sizes_;
+}
+
+static Flt64 _bench_run(ByteSize (*index_of)(const ByteSize), const ByteSize *sizes, ByteSize *out_sink) {
+    HiResClock clock_;
+    ByteSize   sink_ = 0;
+
+    clock_hires_init(&clock_);
+
+    for (ByteSize r = 0; r < BENCH_ROUNDS; ++r)
+        for (ByteSize i = 0; i < BENCH_NUM_SIZES; ++i)
+            sink_ += index_of(sizes[i]);
+
+    Flt64 elapsed_ = clock_hires_elapsed_nanoseconds(&clock_);
+
+    *out_sink += sink_;
+    return elapsed_ / ((Flt64)BENCH_ROUNDS * BENCH_NUM_SIZES);
+}
+
+int main(void) {
+    _bench_golden_compute_size_classes(BENCH_CAPACITY);
+    bitlength_num_classes = _bench_bitlength_class_of(BENCH_CAPACITY) + 1;
+
+    ByteSize *sizes_ = _bench_make_sizes();
+    if (!sizes_) return 1;
+
+    // both lookups must land on the smallest class that fits before their timings mean anything
+    for (ByteSize i = 0; i < BENCH_NUM_SIZES; ++i) {
+        ByteSize golden_    = _bench_golden_index(sizes_[i]);
+        ByteSize bitlength_ = _bench_bitlength_index(sizes_[i]);
+
+        ByteSize golden_size_    = golden_classes[golden_]._size;
+        ByteSize bitlength_size_ = _bench_bitlength_class_size(bitlength_);
+        if (bitlength_size_ > BENCH_CAPACITY) bitlength_size_ = BENCH_CAPACITY;
+
+        Bool golden_fits_    = (golden_size_ >= sizes_[i]) && (!golden_ || golden_classes[golden_ - 1]._size < VYTAL_APPLY_ALIGNMENT(sizes_[i], MEMORY_ALIGNMENT_SIZE));
+        Bool bitlength_fits_ = (bitlength_size_ >= sizes_[i]) && (!bitlength_ || _bench_bitlength_class_size(bitlength_ - 1) < sizes_[i]);
+
+        if (!golden_fits_ || !bitlength_fits_) {
+            fprintf(stderr, "size %zu: golden class %zu (%zu bytes), bit-length class %zu (%zu bytes)\n", sizes_[i], golden_, golden_size_, bitlength_, bitlength_size_);
+            free(sizes_);
+            return 1;
+        }
+    }
+
+    ByteSize sink_ = 0;
+
+    // warm both up once so neither pays for the first page faults and cache misses
+    _bench_run(_bench_golden_index, sizes_, &sink_);
+    _bench_run(_bench_bitlength_index, sizes_, &sink_);
+
+    Flt64 golden_ns_    = _bench_run(_bench_golden_index, sizes_, &sink_);
+    Flt64 bitlength_ns_ = _bench_run(_bench_bitlength_index, sizes_, &sink_);
+
+    printf("size-class index over %d sizes x %d rounds, %zu MB capacity\n", BENCH_NUM_SIZES, BENCH_ROUNDS, (ByteSize)BENCH_CAPACITY / MB_IN_BYTES(1));
+    printf("    golden ratio: %3zu classes, %6.2f ns per lookup\n", golden_num_classes, golden_ns_);
+    printf("    bit length:   %3zu classes, %6.2f ns per lookup\n", bitlength_num_classes, bitlength_ns_);
+    printf("    speedup:      %6.2fx (checksum %zu)\n", golden_ns_ / bitlength_ns_, sink_);
+
+    free(sizes_);
+    return 0;
+}
@@ -0,0 +1,40 @@
+@echo off
+setlocal EnableDelayedExpansion
+
+set "CODEBASE=ring_throughput_benchmark"
+
+rem make sure that VYTAL_ENGINE_PATH is set
+if "%VYTAL_ENGINE_PATH%"=="" (
+    echo Error: VYTAL_ENGINE_PATH is not set.
+    exit /b 1
+)
+
+rem make sure that output directory exists
+if not exist "%VYTAL_ENGINE_PATH%\bin" mkdir "%VYTAL_ENGINE_PATH%\bin"
+
+rem the rings allocate from a memory zone, so the memory manager and what it reads its config with come along
+set "c_filenames=benchmarks\ring_throughput.c src\vytal\core\containers\ring\ring.c src\vytal\core\hal\clock\hires\hires.c src\vytal\core\platform\thread\thread.c"
+set "c_filenames=!c_filenames! src\vytal\core\memory\manager\memory_manager.c src\vytal\core\memory\zone\memory_zone.c"
+for /r src\vytal\core\memory\zone\allocators %%f in (*.c) do (
+    set "c_filenames=!c_filenames! %%f"
+)
+set "c_filenames=!c_filenames! src\vytal\core\platform\memory\memory.c src\vytal\core\platform\filesystem\filesystem.c src\vytal\core\helpers\parse\parse.c"
+
+rem compiler settings
+set "compiler_flags=-O2 -mavx2 -mfma -Wall -Werror -Wvarargs -Wno-unused-function -Wno-discarded-qualifiers"
+set "include_flags=-Isrc"
+set "defines=-D_CRT_SECURE_NO_WARNINGS -DMEMORY_ALIGNMENT_SIZE=16 -DLINE_BUFFER_MAX_SIZE=512 -DSTRING_BUFFER_MAX_SIZE=8192 -DFILENAME_BUFFER_MAX_SIZE=64 -DMEMORY_ZONE_THREAD_CACHES=16 -DMEMORY_ZONE_MAGAZINE_SIZE=32 -DMEMORY_ZONE_SIZE_CLASS_GROUP_BITS=2 -DMEMORY_ZONE_COMMIT_SIZE=65536 "
+
+rem build command
+echo Building '%CODEBASE%'...
+gcc %c_filenames% %compiler_flags% %include_flags% %defines% -o %VYTAL_ENGINE_PATH%\bin\%CODEBASE%.exe
+
+rem check compilation status
+if %errorlevel% neq 0 (
+    echo '%CODEBASE%' build failed!
+    exit /b 1
+) else (
+    echo '%CODEBASE%' build completed.
+)
+
+endlocal
@@ -0,0 +1,35 @@
+@echo off
+setlocal EnableDelayedExpansion
+
+set "CODEBASE=size_class_index_benchmark"
+
+rem make sure that VYTAL_ENGINE_PATH is set
+if "%VYTAL_ENGINE_PATH%"=="" (
+    echo Error: VYTAL_ENGINE_PATH is not set.
+    exit /b 1
+)
+
+rem make sure that output directory exists
+if not exist "%VYTAL_ENGINE_PATH%\bin" mkdir "%VYTAL_ENGINE_PATH%\bin"
+
+rem the benchmark carries its own copies of both lookups and only borrows the clock
+set "c_filenames=benchmarks\size_class_index.c src\vytal\core\hal\clock\hires\hires.c"
+
+rem compiler settings
+set "compiler_flags=-O2 -mavx2 -mfma -Wall -Werror -Wvarargs -Wno-unused-function -Wno-discarded-qualifiers"
+set "include_flags=-Isrc"
+set "defines=-D_CRT_SECURE_NO_WARNINGS -DMEMORY_ALIGNMENT_SIZE=16 -DMEMORY_ZONE_SIZE_CLASS_GROUP_BITS=2 "
+
+rem build command
+echo Building '%CODEBASE%'...
+gcc %c_filenames% %compiler_flags% %include_flags% %defines% -o %VYTAL_ENGINE_PATH%\bin\%CODEBASE%.exe
+
+rem check compilation status
+if %errorlevel% neq 0 (
+    echo '%CODEBASE%' build failed!
+    exit /b 1
+) else (
+    echo '%CODEBASE%' build completed.
+)
+
+endlocal
@@ -12,9 +12,9 @@ if "%VYTAL_ENGINE_PATH%"=="" (
 rem make sure that output directory exists
 if not exist "%VYTAL_ENGINE_PATH%\bin" mkdir "%VYTAL_ENGINE_PATH%\bin"
 
-rem collect all .c files
+rem collect all .c files (benchmarks build on their own)
 set "c_filenames="
-for /r %%f in (*.c) do (
+for /r src %%f in (*.c) do (
     set "c_filenames=!c_filenames! %%f"
 )
 
@@ -22,7 +22,7 @@ rem compiler settings
 set "compiler_flags=-g -mavx2 -mfma -shared -Wall -Werror -Wvarargs -Wno-unused-function -Wno-discarded-qualifiers"
 set "include_flags=-Isrc -I%VYTAL_EXTERNAL_CGLTF% -I%VYTAL_EXTERNAL_GLFW%/include -I%VYTAL_EXTERNAL_VULKAN%/Include -I%VYTAL_EXTERNAL_CGLM%/include -I%VYTAL_EXTERNAL_STB%"
 set "linker_flags=-L%VYTAL_EXTERNAL_GLFW%/lib -lglfw3 -luser32 -lgdi32 -lopengl32 -L%VYTAL_EXTERNAL_VULKAN%/Lib -lvulkan-1"
-set "defines=-DVYTAL_DEBUG -DVYTAL_ENABLE_ASSERTIONS -DVYTAL_EXPORT_DLL -DVYTAL_VULKAN_VALIDATION_LAYERS_ENABLED -D_CRT_SECURE_NO_WARNINGS -DLINE_BUFFER_MAX_SIZE=512 -DSTRING_BUFFER_MAX_SIZE=8192 -DFILENAME_BUFFER_MAX_SIZE=64 -DCVAR_HASHMAP_SIZE=1024 -DMAX_EXCEPTION_DEPTH=10 -DMEMORY_ALIGNMENT_SIZE=16 -DCONTAINER_DEFAULT_CAPACITY=10 -DCONTAINER_RESIZE_FACTOR=2 -DMAX_COMPUTE_DESCRIPTOR_SETS=64 -DMAX_COMPUTE_PIPELINES=16 -DDEFAULT_TEXTURE_WIDTH=512 -DDEFAULT_TEXTURE_HEIGHT=512 -DDEFAULT_TEXTURE_SQUARE_SIZE=64 "
+set "defines=-DVYTAL_DEBUG -DVYTAL_ENABLE_ASSERTIONS -DVYTAL_MEMORY_STATS -DVYTAL_MEMORY_DEBUG -DVYTAL_EXPORT_DLL -DVYTAL_VULKAN_VALIDATION_LAYERS_ENABLED -D_CRT_SECURE_NO_WARNINGS -DLINE_BUFFER_MAX_SIZE=512 -DSTRING_BUFFER_MAX_SIZE=8192 -DFILENAME_BUFFER_MAX_SIZE=64 -DCVAR_HASHMAP_SIZE=1024 -DMAX_EXCEPTION_DEPTH=10 -DMEMORY_ALIGNMENT_SIZE=16 -DMEMORY_ZONE_THREAD_CACHES=16 -DMEMORY_ZONE_MAGAZINE_SIZE=32 -DMEMORY_ZONE_SIZE_CLASS_GROUP_BITS=2 -DMEMORY_ZONE_COMMIT_SIZE=65536 -DCONTAINER_DEFAULT_CAPACITY=10 -DCONTAINER_RESIZE_FACTOR=2 -DCONTAINER_CONCURRENT_MAP_SHARDS=16 -DCONTAINER_CONCURRENT_MAP_READERS=16 -DCONTAINER_SORT_THREADS=8 -DCONTAINER_SORT_PARALLEL_THRESHOLD=32768 -DMAX_COMPUTE_DESCRIPTOR_SETS=64 -DMAX_COMPUTE_PIPELINES=16 -DDEFAULT_TEXTURE_WIDTH=512 -DDEFAULT_TEXTURE_HEIGHT=512 -DDEFAULT_TEXTURE_SQUARE_SIZE=64 "
 
 rem build command
 echo Building '%CODEBASE%'...
@@ -1,5 +1,6 @@
 #include "loader_gltf.h"
 
+#include <stdlib.h>
 #include <string.h>
 
 #define CGLTF_IMPLEMENTATION
@@ -10,6 +11,46 @@
 
 #include "vytal/core/memory/zone/memory_zone.h"
 
+// cgltf parse data lives on the scratch stack and goes away with the loader's marker,
+// whatever does not fit there falls back to the heap
+VoidPtr _mesh_loader_gltf_scratch_alloc(VoidPtr user, cgltf_size size) {
+    VoidPtr ptr_ = NULL;
+    if (memory_zone_allocate(MEMORY_ZONE_SCRATCH, size, &ptr_, NULL) == MEMORY_ZONE_SUCCESS)
+        return ptr_;
+
+    return malloc(size);
+}
+
+void _mesh_loader_gltf_scratch_free(VoidPtr user, VoidPtr ptr) {
+    MemoryZone *scratch_ = (MemoryZone *)user;
+
+    UIntPtr start_ = (UIntPtr)scratch_->_start_addr;
+    if ((UIntPtr)ptr >= start_ && (UIntPtr)ptr < start_ + scratch_->_capacity) return;
+
+    free(ptr);
+}
+
+// points cgltf at the scratch stack, if there is one
+MemoryZoneMarker _mesh_loader_gltf_scratch_begin(cgltf_options *options) {
+    MemoryZone      *scratch_ = NULL;
+    MemoryZoneMarker marker_  = 0;
+
+    if ((memory_zone_get(MEMORY_ZONE_SCRATCH, &scratch_) == MEMORY_ZONE_SUCCESS) && (memory_zone_push_marker(MEMORY_ZONE_SCRATCH, &marker_) == MEMORY_ZONE_SUCCESS)) {
+        options->memory.alloc_func = _mesh_loader_gltf_scratch_alloc;
+        options->memory.free_func  = _mesh_loader_gltf_scratch_free;
+        options->memory.user_data  = scratch_;
+    }
+
+    return marker_;
+}
+
+void _mesh_loader_gltf_scratch_end(cgltf_options *options, cgltf_data *data, const MemoryZoneMarker marker) {
+    if (data) cgltf_free(data);
+
+    if (options->memory.alloc_func)
+        memory_zone_pop_to_marker(MEMORY_ZONE_SCRATCH, marker);
+}
+
 MeshResult _mesh_loader_load_from_data(cgltf_data *data, Mesh *out_mesh) {
     if (cgltf_validate(data) != cgltf_result_success)
         return MESH_ERROR_FILE_PARSE_FAILED;
@@ -44,17 +85,20 @@ MeshResult _mesh_loader_load_from_data(cgltf_data *data, Mesh *out_mesh) {
             total_image_size_ += image_->buffer_view->size;
     }
 
-    ByteSize total_size_ = sizeof(struct Mesh_Handle) + ((sizeof(ByteSize) * data->images_count) * 2) + (vertex_size_ + index_size_ + total_image_size_);
-    ByteSize alloc_size_ = 0;
-    if (memory_zone_allocate("assets", total_size_, (VoidPtr *)out_mesh, &alloc_size_) != MEMORY_ZONE_SUCCESS)
+    ByteSize header_size_ = sizeof(struct Mesh_Handle) + ((sizeof(ByteSize) * data->images_count) * 2);
+    ByteSize total_size_  = header_size_ + (vertex_size_ + index_size_ + total_image_size_);
+    ByteSize alloc_size_  = 0;
+    if (memory_zone_allocate(MEMORY_ZONE_ASSETS, total_size_, (VoidPtr *)out_mesh, &alloc_size_) != MEMORY_ZONE_SUCCESS)
         return MESH_ERROR_ALLOCATION_FAILED;
-    memset((*out_mesh), 0, alloc_size_);
+
+    // buffer data is copied over below, so only the header and offset tables need clearing
+    memset((*out_mesh), 0, header_size_);
 
     // configure members
     {
         (*out_mesh)->_texture_offsets = (ByteSize *)((BytePtr)(*out_mesh) + sizeof(struct Mesh_Handle));
         (*out_mesh)->_texture_sizes   = (ByteSize *)((BytePtr)(*out_mesh)->_texture_offsets + (sizeof(ByteSize) * data->images_count));
-        (*out_mesh)->_vertex_offset   = sizeof(struct Mesh_Handle) + ((sizeof(ByteSize) * data->images_count) * 2);
+        (*out_mesh)->_vertex_offset   = header_size_;
         (*out_mesh)->_index_offset    = (*out_mesh)->_vertex_offset + vertex_size_;
 
         ByteSize running_offset_ = (*out_mesh)->_index_offset + index_size_;
@@ -125,51 +169,53 @@ MeshResult _mesh_loader_load_from_data(cgltf_data *data, Mesh *out_mesh) {
 MeshResult mesh_loader_gltf_load_from_file(ConstStr filepath, Mesh *out_mesh) {
     if (!filepath || !out_mesh) return MESH_ERROR_INVALID_PARAM;
 
-    cgltf_options options_ = {0};
-    cgltf_data   *data_    = NULL;
+    cgltf_options    options_ = {0};
+    cgltf_data      *data_    = NULL;
+    MemoryZoneMarker marker_  = _mesh_loader_gltf_scratch_begin(&options_);
 
-    if (cgltf_parse_file(&options_, filepath, &data_) != cgltf_result_success)
+    if (cgltf_parse_file(&options_, filepath, &data_) != cgltf_result_success) {
+        _mesh_loader_gltf_scratch_end(&options_, NULL, marker_);
         return MESH_ERROR_FILE_PARSE_FAILED;
+    }
 
-    if (cgltf_load_buffers(&options_, data_, filepath) != cgltf_result_success)
+    if (cgltf_load_buffers(&options_, data_, filepath) != cgltf_result_success) {
+        _mesh_loader_gltf_scratch_end(&options_, data_, marker_);
         return MESH_ERROR_FILE_PARSE_FAILED;
+    }
 
     MeshResult load_from_data_ = _mesh_loader_load_from_data(data_, out_mesh);
-    if (load_from_data_ != MESH_SUCCESS) {
-        cgltf_free(data_);
-        return load_from_data_;
-    }
+    _mesh_loader_gltf_scratch_end(&options_, data_, marker_);
 
-    cgltf_free(data_);
-    return MESH_SUCCESS;
+    return load_from_data_;
 }
 
 MeshResult mesh_loader_gltf_load_from_memory(const VoidPtr buffer, const ByteSize buffer_size, Mesh *out_mesh) {
     if (!buffer || !buffer_size || !out_mesh) return MESH_ERROR_INVALID_PARAM;
 
-    cgltf_options options_ = {0};
-    cgltf_data   *data_    = NULL;
+    cgltf_options    options_ = {0};
+    cgltf_data      *data_    = NULL;
+    MemoryZoneMarker marker_  = _mesh_loader_gltf_scratch_begin(&options_);
 
-    if (cgltf_parse(&options_, buffer, (cgltf_size)buffer_size, &data_) != cgltf_result_success)
+    if (cgltf_parse(&options_, buffer, (cgltf_size)buffer_size, &data_) != cgltf_result_success) {
+        _mesh_loader_gltf_scratch_end(&options_, NULL, marker_);
         return MESH_ERROR_FILE_PARSE_FAILED;
+    }
 
-    if (cgltf_load_buffers(&options_, data_, NULL) != cgltf_result_success)
+    if (cgltf_load_buffers(&options_, data_, NULL) != cgltf_result_success) {
+        _mesh_loader_gltf_scratch_end(&options_, data_, marker_);
         return MESH_ERROR_FILE_PARSE_FAILED;
+    }
 
     MeshResult load_from_data_ = _mesh_loader_load_from_data(data_, out_mesh);
-    if (load_from_data_ != MESH_SUCCESS) {
-        cgltf_free(data_);
-        return load_from_data_;
-    }
+    _mesh_loader_gltf_scratch_end(&options_, data_, marker_);
 
-    cgltf_free(data_);
-    return MESH_SUCCESS;
+    return load_from_data_;
 }
 
 MeshResult mesh_loader_gltf_unload(Mesh mesh) {
     if (!mesh) return MESH_ERROR_INVALID_PARAM;
 
-    if (memory_zone_deallocate("assets", mesh, mesh->_memory_size) != MEMORY_ZONE_SUCCESS)
+    if (memory_zone_deallocate(MEMORY_ZONE_ASSETS, mesh, mesh->_memory_size) != MEMORY_ZONE_SUCCESS)
         return MESH_ERROR_DEALLOCATION_FAILED;
 
     mesh = NULL;
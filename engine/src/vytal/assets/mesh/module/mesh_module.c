@@ -8,8 +8,8 @@
 #include "vytal/core/memory/zone/memory_zone.h"
 
 typedef struct Mesh_Module_State {
-    Map   _mesh_lookup;
-    Array _registered_meshes;
+    ConcurrentMap _mesh_lookup;  // resolved from worker threads, registered and released from the main one only
+    Array         _registered_meshes;
 
     Bool     _initialized;
     ByteSize _memory_size;
@@ -22,14 +22,14 @@ MeshModuleResult mesh_module_startup(void) {
 
     // allocate module state
     ByteSize alloc_size_ = 0;
-    if (memory_zone_allocate("modules", sizeof(MeshModuleState), (VoidPtr *)&state, &alloc_size_) != MEMORY_ZONE_SUCCESS)
+    if (memory_zone_allocate(MEMORY_ZONE_MODULES, sizeof(MeshModuleState), (VoidPtr *)&state, &alloc_size_) != MEMORY_ZONE_SUCCESS)
         return MESH_MODULE_ERROR_ALLOCATION_FAILED;
     memset(state, 0, alloc_size_);
 
     // allocate and configure members
     {
         // mesh lookup
-        if (container_map_construct(sizeof(Mesh), &state->_mesh_lookup) != CONTAINER_SUCCESS)
+        if (container_concurrent_map_construct(sizeof(Mesh), &state->_mesh_lookup) != CONTAINER_SUCCESS)
             return MESH_MODULE_ERROR_ALLOCATION_FAILED;
 
         // registered meshes
@@ -63,14 +63,14 @@ MeshModuleResult mesh_module_shutdown(void) {
         }
 
         // mesh lookup
-        if (container_map_destruct(state->_mesh_lookup) != CONTAINER_SUCCESS)
+        if (container_concurrent_map_destruct(state->_mesh_lookup) != CONTAINER_SUCCESS)
             return MESH_MODULE_ERROR_DEALLOCATION_FAILED;
         state->_mesh_lookup = NULL;
     }
 
     // deallocate module state
     {
-        if (memory_zone_deallocate("modules", state, state->_memory_size) != MEMORY_ZONE_SUCCESS)
+        if (memory_zone_deallocate(MEMORY_ZONE_MODULES, state, state->_memory_size) != MEMORY_ZONE_SUCCESS)
             return MESH_MODULE_ERROR_ALLOCATION_FAILED;
         state = NULL;
     }
@@ -83,7 +83,7 @@ MeshModuleResult mesh_module_register(ConstStr name, Mesh mesh) {
     if (!name || !mesh) return MESH_MODULE_ERROR_INVALID_PARAM;
 
     // insert into lookup
-    if (container_map_insert(&state->_mesh_lookup, name, (VoidPtr)&mesh) != CONTAINER_SUCCESS)
+    if (container_concurrent_map_insert(state->_mesh_lookup, name, (VoidPtr)&mesh) != CONTAINER_SUCCESS)
         return MESH_MODULE_ERROR_REGISTER_FAILED;
 
     // if successful, store reference into the array
@@ -98,7 +98,7 @@ MeshModuleResult mesh_module_unregister(ConstStr name) {
     if (!name) return MESH_MODULE_ERROR_INVALID_PARAM;
 
     Mesh mesh_ = NULL;
-    if (container_map_search(state->_mesh_lookup, name, (VoidPtr)&mesh_) != CONTAINER_SUCCESS)
+    if (container_concurrent_map_search(state->_mesh_lookup, name, (VoidPtr)&mesh_) != CONTAINER_SUCCESS)
         return MESH_MODULE_ERROR_UNREGISTER_FAILED;
 
     // mesh is not registered
@@ -109,7 +109,7 @@ MeshModuleResult mesh_module_unregister(ConstStr name) {
         return MESH_MODULE_ERROR_UNREGISTER_FAILED;
 
     // remove from lookup
-    if (container_map_remove(&state->_mesh_lookup, name) != CONTAINER_SUCCESS)
+    if (container_concurrent_map_remove(state->_mesh_lookup, name) != CONTAINER_SUCCESS)
         return MESH_MODULE_ERROR_UNREGISTER_FAILED;
 
     return MESH_MODULE_SUCCESS;
@@ -120,7 +120,7 @@ Mesh mesh_module_get(ConstStr name) {
     if (!name) return NULL;
 
     Mesh mesh_ = NULL;
-    if (container_map_search(state->_mesh_lookup, name, (VoidPtr)&mesh_) != CONTAINER_SUCCESS)
+    if (container_concurrent_map_search(state->_mesh_lookup, name, (VoidPtr)&mesh_) != CONTAINER_SUCCESS)
         return NULL;
     if (!mesh_) return NULL;
 
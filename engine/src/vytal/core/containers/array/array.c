@@ -4,7 +4,19 @@
 #include <stdlib.h>
 #include <string.h>
 
+#if defined(__AVX2__) || defined(__SSE4_1__)
+#    include <immintrin.h>
+#endif
+
 #include "vytal/core/memory/zone/memory_zone.h"
+#include "vytal/core/platform/thread/thread.h"
+
+// elements of 1, 2, 4 or 8 bytes are searched a chunk of this many bytes at a time
+#if defined(__AVX2__)
+#    define ARRAY_CHUNK_SIZE 32
+#elif defined(__SSE4_1__)
+#    define ARRAY_CHUNK_SIZE 16
+#endif
 
 struct Container_Array {
     VoidPtr  _pool;
@@ -20,12 +32,20 @@ ContainerResult _container_array_resize(Array *array, const ByteSize new_capacit
     Array old_array_ = *array;
     Array new_array_ = NULL;
 
-    ByteSize base_new_alloc_size_ = old_array_->_memory_size * CONTAINER_RESIZE_FACTOR;
+    ByteSize base_new_alloc_size_ = VYTAL_APPLY_ALIGNMENT(sizeof(struct Container_Array) + (old_array_->_data_size * new_capacity), MEMORY_ALIGNMENT_SIZE);
     ByteSize new_alloc_size_      = 0;
 
-    if (memory_zone_allocate("containers", base_new_alloc_size_, (VoidPtr *)&new_array_, &new_alloc_size_) != MEMORY_ZONE_SUCCESS)
+    // grown in place, the handle (and every element pointer) stays valid
+    if (memory_zone_extend(MEMORY_ZONE_CONTAINERS, old_array_, old_array_->_memory_size, base_new_alloc_size_, &new_alloc_size_) == MEMORY_ZONE_SUCCESS) {
+        memset((BytePtr)old_array_ + old_array_->_memory_size, 0, new_alloc_size_ - old_array_->_memory_size);
+
+        old_array_->_capacity    = new_capacity;
+        old_array_->_memory_size = new_alloc_size_;
+        return CONTAINER_SUCCESS;
+    }
+
+    if (memory_zone_allocate_zeroed(MEMORY_ZONE_CONTAINERS, base_new_alloc_size_, (VoidPtr *)&new_array_, &new_alloc_size_) != MEMORY_ZONE_SUCCESS)
         return CONTAINER_ERROR_ALLOCATION_FAILED;
-    memset(new_array_, 0, new_alloc_size_);
 
     new_array_->_data_size   = old_array_->_data_size;
     new_array_->_size        = old_array_->_size;
@@ -35,29 +55,283 @@ ContainerResult _container_array_resize(Array *array, const ByteSize new_capacit
 
     memmove(new_array_->_pool, old_array_->_pool, old_array_->_data_size * old_array_->_size);
 
-    if (memory_zone_deallocate("containers", old_array_, old_array_->_memory_size) != MEMORY_ZONE_SUCCESS)
+    if (memory_zone_deallocate(MEMORY_ZONE_CONTAINERS, old_array_, old_array_->_memory_size) != MEMORY_ZONE_SUCCESS)
         return CONTAINER_ERROR_DEALLOCATION_FAILED;
 
     *array = new_array_;
     return CONTAINER_SUCCESS;
 }
 
+// makes room for count elements, at least a resize factor's worth so repeated calls stay amortized
+VYTAL_INLINE ContainerResult _container_array_grow(Array *array, const ByteSize count) {
+    if (count <= (*array)->_capacity) return CONTAINER_SUCCESS;
+
+    ByteSize new_capacity_ = (*array)->_capacity * CONTAINER_RESIZE_FACTOR;
+    return _container_array_resize(array, (new_capacity_ > count) ? new_capacity_ : count);
+}
+
+VYTAL_INLINE UInt32 _container_array_ctz(UInt32 mask) {
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_ctz(mask);
+
+#elif defined(_MSC_VER)
+    unsigned long index_;
+    _BitScanForward(&index_, mask);
+    return (UInt32)index_;
+
+#else
+    UInt32 count_ = 0;
+    while ((mask & 1) == 0) {
+        mask >>= 1;
+        ++count_;
+    }
+
+    return count_;
+#endif
+}
+
+#if defined(ARRAY_CHUNK_SIZE)
+// every byte of a matching element sets its bit, so the lowest bit over the element size is its index in the chunk
+VYTAL_INLINE UInt32 _container_array_chunk_match(const BytePtr chunk, const VoidPtr data, const ByteSize data_size) {
+    UInt64 value_ = 0;
+    memcpy(&value_, data, data_size);
+
+#    if defined(__AVX2__)
+    __m256i chunk_ = _mm256_loadu_si256((const __m256i *)chunk);
+
+    switch (data_size) {
+        case 1: return (UInt32)_mm256_movemask_epi8(_mm256_cmpeq_epi8(chunk_, _mm256_set1_epi8((char)value_)));
+        case 2: return (UInt32)_mm256_movemask_epi8(_mm256_cmpeq_epi16(chunk_, _mm256_set1_epi16((short)value_)));
+        case 4: return (UInt32)_mm256_movemask_epi8(_mm256_cmpeq_epi32(chunk_, _mm256_set1_epi32((int)value_)));
+        default: return (UInt32)_mm256_movemask_epi8(_mm256_cmpeq_epi64(chunk_, _mm256_set1_epi64x((long long)value_)));
+    }
+
+#    else
+    __m128i chunk_ = _mm_loadu_si128((const __m128i *)chunk);
+
+    switch (data_size) {
+        case 1: return (UInt32)_mm_movemask_epi8(_mm_cmpeq_epi8(chunk_, _mm_set1_epi8((char)value_)));
+        case 2: return (UInt32)_mm_movemask_epi8(_mm_cmpeq_epi16(chunk_, _mm_set1_epi16((short)value_)));
+        case 4: return (UInt32)_mm_movemask_epi8(_mm_cmpeq_epi32(chunk_, _mm_set1_epi32((int)value_)));
+        default: return (UInt32)_mm_movemask_epi8(_mm_cmpeq_epi64(chunk_, _mm_set1_epi64x((long long)value_)));
+    }
+#    endif
+}
+#endif
+
+VYTAL_INLINE ByteSize _container_array_sort_key_width(const ContainerSortKey key_type) {
+    switch (key_type) {
+        case CONTAINER_SORT_KEY_UINT32:
+        case CONTAINER_SORT_KEY_INT32:
+        case CONTAINER_SORT_KEY_FLT32: return sizeof(UInt32);
+
+        case CONTAINER_SORT_KEY_UINT64:
+        case CONTAINER_SORT_KEY_INT64:
+        case CONTAINER_SORT_KEY_FLT64: return sizeof(UInt64);
+
+        default: return 0;
+    }
+}
+
+// maps a key onto an unsigned integer with the same order: signed keys flip the sign bit,
+// floats flip every bit when negative and only the sign bit otherwise
+VYTAL_INLINE UInt64 _container_array_sort_key(const BytePtr key, const ContainerSortKey key_type) {
+    if (_container_array_sort_key_width(key_type) == sizeof(UInt32)) {
+        UInt32 bits_;
+        memcpy(&bits_, key, sizeof(bits_));
+
+        if (key_type == CONTAINER_SORT_KEY_INT32) return bits_ ^ 0x80000000u;
+        if (key_type == CONTAINER_SORT_KEY_FLT32) return (bits_ & 0x80000000u) ? (UInt32)~bits_ : (bits_ | 0x80000000u);
+        return bits_;
+    }
+
+    UInt64 bits_;
+    memcpy(&bits_, key, sizeof(bits_));
+
+    if (key_type == CONTAINER_SORT_KEY_INT64) return bits_ ^ 0x8000000000000000ull;
+    if (key_type == CONTAINER_SORT_KEY_FLT64) return (bits_ & 0x8000000000000000ull) ? ~bits_ : (bits_ | 0x8000000000000000ull);
+    return bits_;
+}
+
+// state every worker of a parallel sort shares; the workers are started once per sort and meet at the
+// barrier between rounds, so each round only costs a wait instead of a thread start
+typedef struct Container_Array_Sort_Shared {
+    BytePtr  _pool;
+    BytePtr  _temp;
+    ByteSize _data_size;
+    ByteSize _size;
+    ByteSize _chunk;
+    Int32 (*_compare)(const void *left, const void *right);
+
+    // the count is only known once every thread that could be started has been, so workers wait on the gate for it
+    volatile ByteSize _count;
+    volatile Bool     _gate;
+
+    // the last thread to arrive resets the count and moves the generation on, which lets the others through
+    volatile ByteSize _arrived;
+    volatile ByteSize _generation;
+} ContainerArraySortShared;
+
+typedef struct Container_Array_Sort_Worker {
+    ContainerArraySortShared *_shared;
+    ByteSize                  _index;
+} ContainerArraySortWorker;
+
+VYTAL_INLINE void _container_array_sort_barrier(ContainerArraySortShared *shared) {
+    ByteSize generation_ = __atomic_load_n(&shared->_generation, __ATOMIC_ACQUIRE);
+
+    if (__atomic_add_fetch(&shared->_arrived, 1, __ATOMIC_ACQ_REL) == shared->_count) {
+        __atomic_store_n(&shared->_arrived, 0, __ATOMIC_RELAXED);
+        __atomic_store_n(&shared->_generation, generation_ + 1, __ATOMIC_RELEASE);
+        return;
+    }
+
+    // a round may take a while longer on the other threads, so the wait gives up its time slice
+    while (__atomic_load_n(&shared->_generation, __ATOMIC_ACQUIRE) == generation_) platform_thread_yield();
+}
+
+// how many of the first diagonal merged elements of two sorted runs come from the left one (merge path);
+// ties go to the left run, so slices split this way merge into the same stable order as a single pass
+VYTAL_INLINE ByteSize _container_array_sort_split(ContainerArraySortShared *shared, const BytePtr left, const ByteSize left_count, const BytePtr right, const ByteSize right_count, const ByteSize diagonal) {
+    ByteSize data_size_ = shared->_data_size;
+    ByteSize low_       = (diagonal > right_count) ? diagonal - right_count : 0;
+    ByteSize high_      = (diagonal < left_count) ? diagonal : left_count;
+
+    while (low_ < high_) {
+        ByteSize middle_ = low_ + ((high_ - low_) / 2);
+
+        if (shared->_compare(left + (middle_ * data_size_), right + ((diagonal - middle_ - 1) * data_size_)) <= 0)
+            low_ = middle_ + 1;
+        else
+            high_ = middle_;
+    }
+
+    return low_;
+}
+
+VYTAL_INLINE void _container_array_sort_merge(ContainerArraySortShared *shared, BytePtr left, const BytePtr left_end, BytePtr right, const BytePtr right_end, BytePtr out) {
+    ByteSize data_size_ = shared->_data_size;
+
+    // already in order across the seam (or nothing to merge with), so the runs are copied as they are
+    if ((left == left_end) || (right == right_end) || (shared->_compare(left_end - data_size_, right) <= 0)) {
+        memcpy(out, left, left_end - left);
+        memcpy(out + (left_end - left), right, right_end - right);
+        return;
+    }
+
+    // ties take the left run first, which keeps the merge stable
+    while ((left < left_end) && (right < right_end)) {
+        if (shared->_compare(right, left) < 0) {
+            memcpy(out, right, data_size_);
+            right += data_size_;
+        } else {
+            memcpy(out, left, data_size_);
+            left += data_size_;
+        }
+
+        out += data_size_;
+    }
+
+    memcpy(out, left, left_end - left);
+    memcpy(out + (left_end - left), right, right_end - right);
+}
+
+// thread entry point, so it can't be inline. every worker sorts its own chunk, then writes an even share of
+// each merge round's output, whichever pairs of runs that share falls across
+static void _container_array_sort_worker(VoidPtr worker) {
+    ContainerArraySortWorker *worker_ = worker;
+    ContainerArraySortShared *shared_ = worker_->_shared;
+
+    while (!__atomic_load_n(&shared_->_gate, __ATOMIC_ACQUIRE)) platform_thread_yield();
+
+    ByteSize index_     = worker_->_index;
+    ByteSize count_     = shared_->_count;
+    ByteSize size_      = shared_->_size;
+    ByteSize data_size_ = shared_->_data_size;
+    ByteSize chunk_     = shared_->_chunk;
+
+    if (index_ * chunk_ < size_) {
+        ByteSize right_ = ((index_ + 1) * chunk_ < size_) ? (index_ + 1) * chunk_ : size_;
+        qsort(shared_->_pool + (index_ * chunk_ * data_size_), right_ - (index_ * chunk_), data_size_, shared_->_compare);
+    }
+
+    _container_array_sort_barrier(shared_);
+
+    BytePtr  src_   = shared_->_pool;
+    BytePtr  dst_   = shared_->_temp;
+    ByteSize begin_ = (index_ * size_) / count_;
+    ByteSize end_   = ((index_ + 1) * size_) / count_;
+
+    for (ByteSize width = chunk_; width < size_; width *= 2) {
+        // the pairs of runs whose merged output overlaps this worker's share
+        for (ByteSize left = (begin_ / (width * 2)) * (width * 2); left < end_; left += width * 2) {
+            ByteSize middle_ = (left + width < size_) ? left + width : size_;
+            ByteSize right_  = (middle_ + width < size_) ? middle_ + width : size_;
+
+            ByteSize from_ = ((begin_ > left) ? begin_ : left) - left;
+            ByteSize to_   = ((end_ < right_) ? end_ : right_) - left;
+
+            BytePtr  left_run_    = src_ + (left * data_size_);
+            BytePtr  right_run_   = src_ + (middle_ * data_size_);
+            ByteSize left_count_  = middle_ - left;
+            ByteSize right_count_ = right_ - middle_;
+
+            ByteSize left_from_ = _container_array_sort_split(shared_, left_run_, left_count_, right_run_, right_count_, from_);
+            ByteSize left_to_   = _container_array_sort_split(shared_, left_run_, left_count_, right_run_, right_count_, to_);
+
+            _container_array_sort_merge(shared_,
+                                        left_run_ + (left_from_ * data_size_), left_run_ + (left_to_ * data_size_),
+                                        right_run_ + ((from_ - left_from_) * data_size_), right_run_ + ((to_ - left_to_) * data_size_),
+                                        dst_ + ((left + from_) * data_size_));
+        }
+
+        // nobody reads a round's output before all of it is written, nor overwrites its input while it is being read
+        _container_array_sort_barrier(shared_);
+
+        BytePtr swap_ = src_;
+        src_          = dst_;
+        dst_          = swap_;
+    }
+
+    if (src_ != shared_->_pool) memcpy(shared_->_pool + (begin_ * data_size_), src_ + (begin_ * data_size_), (end_ - begin_) * data_size_);
+}
+
+// first element at or after index that equals data (the size if there is none)
+VYTAL_INLINE ByteSize _container_array_find(Array array, const VoidPtr data, ByteSize index) {
+    BytePtr  pool_      = (BytePtr)array->_pool;
+    ByteSize data_size_ = array->_data_size;
+
+#if defined(ARRAY_CHUNK_SIZE)
+    if ((data_size_ == 1) || (data_size_ == 2) || (data_size_ == 4) || (data_size_ == 8)) {
+        ByteSize per_chunk_ = ARRAY_CHUNK_SIZE / data_size_;
+
+        for (; index + per_chunk_ <= array->_size; index += per_chunk_) {
+            UInt32 match_ = _container_array_chunk_match(pool_ + (index * data_size_), data, data_size_);
+            if (match_) return index + (_container_array_ctz(match_) / data_size_);
+        }
+    }
+#endif
+
+    for (; index < array->_size; ++index)
+        if (!memcmp(pool_ + (index * data_size_), data, data_size_)) return index;
+
+    return array->_size;
+}
+
 ContainerResult container_array_construct(const ByteSize data_size, Array *out_new_array) {
     if (!data_size) return CONTAINER_ERROR_INVALID_PARAM;
 
     ByteSize pool_size_  = data_size * CONTAINER_DEFAULT_CAPACITY;
     ByteSize alloc_size_ = VYTAL_APPLY_ALIGNMENT(sizeof(struct Container_Array) + pool_size_, MEMORY_ALIGNMENT_SIZE);
 
-    if (memory_zone_allocate("containers", alloc_size_, (VoidPtr *)out_new_array, &alloc_size_) != MEMORY_ZONE_SUCCESS)
+    if (memory_zone_allocate_zeroed(MEMORY_ZONE_CONTAINERS, alloc_size_, (VoidPtr *)out_new_array, &alloc_size_) != MEMORY_ZONE_SUCCESS)
         return CONTAINER_ERROR_ALLOCATION_FAILED;
-    memset(*out_new_array, 0, alloc_size_);
 
     (*out_new_array)->_data_size   = data_size;
     (*out_new_array)->_capacity    = CONTAINER_DEFAULT_CAPACITY;
     (*out_new_array)->_size        = 0;
     (*out_new_array)->_memory_size = alloc_size_;
     (*out_new_array)->_pool        = (VoidPtr)((UIntPtr)(*out_new_array) + sizeof(struct Container_Array));
-    memset((*out_new_array)->_pool, 0, pool_size_);
 
     return CONTAINER_SUCCESS;
 }
@@ -66,7 +340,7 @@ ContainerResult container_array_destruct(Array array) {
     if (!array) return CONTAINER_ERROR_INVALID_PARAM;
     if (!array->_pool || !array->_memory_size) return CONTAINER_ERROR_NOT_ALLOCATED;
 
-    if (memory_zone_deallocate("containers", array, array->_memory_size) != MEMORY_ZONE_SUCCESS)
+    if (memory_zone_deallocate(MEMORY_ZONE_CONTAINERS, array, array->_memory_size) != MEMORY_ZONE_SUCCESS)
         return CONTAINER_ERROR_DEALLOCATION_FAILED;
 
     array = NULL;
@@ -95,6 +369,21 @@ ContainerResult container_array_push(Array *array, VoidPtr new_data) {
     return CONTAINER_SUCCESS;
 }
 
+// one growth and one copy for the whole run
+ContainerResult container_array_push_many(Array *array, const VoidPtr data, const ByteSize count) {
+    if (!array || !data) return CONTAINER_ERROR_INVALID_PARAM;
+    if (!(*array)->_memory_size) return CONTAINER_ERROR_NOT_ALLOCATED;
+
+    ContainerResult grow_ = _container_array_grow(array, (*array)->_size + count);
+    if (grow_ != CONTAINER_SUCCESS)
+        return grow_;
+
+    memcpy((BytePtr)(*array)->_pool + ((*array)->_data_size * (*array)->_size), data, (*array)->_data_size * count);
+    (*array)->_size += count;
+
+    return CONTAINER_SUCCESS;
+}
+
 ContainerResult container_array_pop(Array *array) {
     if (!array) return CONTAINER_ERROR_INVALID_PARAM;
     if (!(*array)->_memory_size) return CONTAINER_ERROR_NOT_ALLOCATED;
@@ -143,34 +432,28 @@ ContainerResult container_array_remove(Array *array, const VoidPtr data, const B
     if (!(*array)->_memory_size) return CONTAINER_ERROR_NOT_ALLOCATED;
     if (!(*array)->_size) return CONTAINER_ERROR_EMPTY_DATA;
 
-    for (ByteSize i = 0; i < (*array)->_size; ++i) {
-        VoidPtr elem_ = (*array)->_pool + ((*array)->_data_size * i);
-
-        if (!memcmp(elem_, data, (*array)->_data_size)) {
-            // found element with matching data...
-
-            // move the trailing train left in data_size bytes
-            // set now-inactive region to 0
-            {
-                UIntPtr shift_src_  = (UIntPtr)((*array)->_pool) + ((*array)->_data_size * (i + 1));
-                UIntPtr shift_dest_ = shift_src_ - (*array)->_data_size;
-                memmove((VoidPtr)shift_dest_, (VoidPtr)shift_src_, (*array)->_data_size * ((*array)->_size - i));
+    Array    array_     = *array;
+    BytePtr  pool_      = (BytePtr)array_->_pool;
+    ByteSize data_size_ = array_->_data_size;
+    ByteSize index_     = _container_array_find(array_, data, 0);
+    if (index_ == array_->_size) return CONTAINER_SUCCESS;
 
-                memset((VoidPtr)((BytePtr)(*array)->_pool + ((*array)->_data_size * ((*array)->_size - 1))), 0, (*array)->_data_size);
-            }
+    // every run of kept elements between two matches moves down once
+    ByteSize write_ = index_;
+    while (index_ < array_->_size) {
+        ByteSize next_ = remove_all ? _container_array_find(array_, data, index_ + 1) : array_->_size;
+        ByteSize run_  = next_ - (index_ + 1);
 
-            // update array size and proceed
-            {
-                --(*array)->_size;
+        memmove(pool_ + (write_ * data_size_), pool_ + ((index_ + 1) * data_size_), run_ * data_size_);
 
-                if (remove_all)  // remove all the matching elements
-                    continue;
-                else  // remove only the first found element
-                    break;
-            }
-        }
+        write_ += run_;
+        index_ = next_;
     }
 
+    // set now-inactive region to 0 and update array size
+    memset(pool_ + (write_ * data_size_), 0, (array_->_size - write_) * data_size_);
+    array_->_size = write_;
+
     return CONTAINER_SUCCESS;
 }
 
@@ -184,7 +467,7 @@ ContainerResult container_array_remove_at_index(Array *array, const ByteSize ind
     {
         UIntPtr shift_src_  = (UIntPtr)((*array)->_pool) + ((*array)->_data_size * (index + 1));
         UIntPtr shift_dest_ = shift_src_ - (*array)->_data_size;
-        memmove((VoidPtr)shift_dest_, (VoidPtr)shift_src_, (*array)->_data_size * ((*array)->_size - index));
+        memmove((VoidPtr)shift_dest_, (VoidPtr)shift_src_, (*array)->_data_size * ((*array)->_size - index - 1));
     }
 
     // set now-inactive region to 0 and update array size
@@ -196,6 +479,49 @@ ContainerResult container_array_remove_at_index(Array *array, const ByteSize ind
     return CONTAINER_SUCCESS;
 }
 
+// the last element takes the removed one's place, so the order is not kept
+ContainerResult container_array_swap_remove(Array *array, const ByteSize index) {
+    if (!array) return CONTAINER_ERROR_INVALID_PARAM;
+    if (!(*array)->_memory_size) return CONTAINER_ERROR_NOT_ALLOCATED;
+    if (!(*array)->_size) return CONTAINER_ERROR_EMPTY_DATA;
+    if (index >= (*array)->_size) return CONTAINER_ERROR_INVALID_PARAM;
+
+    ByteSize data_size_ = (*array)->_data_size;
+    BytePtr  last_      = (BytePtr)(*array)->_pool + (data_size_ * ((*array)->_size - 1));
+
+    if (index != (*array)->_size - 1)
+        memcpy((BytePtr)(*array)->_pool + (data_size_ * index), last_, data_size_);
+
+    memset(last_, 0, data_size_);
+    --(*array)->_size;
+
+    return CONTAINER_SUCCESS;
+}
+
+ContainerResult container_array_reserve(Array *array, const ByteSize count) {
+    if (!array) return CONTAINER_ERROR_INVALID_PARAM;
+    if (!(*array)->_memory_size) return CONTAINER_ERROR_NOT_ALLOCATED;
+    if (count <= (*array)->_capacity) return CONTAINER_SUCCESS;
+
+    return _container_array_resize(array, count);
+}
+
+// new elements are left as the block has them unless zeroed is set; dropped ones are not cleared
+ContainerResult container_array_resize(Array *array, const ByteSize new_size, const Bool zeroed) {
+    if (!array) return CONTAINER_ERROR_INVALID_PARAM;
+    if (!(*array)->_memory_size) return CONTAINER_ERROR_NOT_ALLOCATED;
+
+    ContainerResult grow_ = _container_array_grow(array, new_size);
+    if (grow_ != CONTAINER_SUCCESS)
+        return grow_;
+
+    if (zeroed && (new_size > (*array)->_size))
+        memset((BytePtr)(*array)->_pool + ((*array)->_data_size * (*array)->_size), 0, (*array)->_data_size * (new_size - (*array)->_size));
+
+    (*array)->_size = new_size;
+    return CONTAINER_SUCCESS;
+}
+
 ContainerResult container_array_clear(Array *array) {
     if (!array) return CONTAINER_ERROR_INVALID_PARAM;
     if (!(*array)->_memory_size) return CONTAINER_ERROR_NOT_ALLOCATED;
@@ -216,6 +542,127 @@ ContainerResult container_array_sort(Array *array, Int32 (*compare)(const void *
     return CONTAINER_SUCCESS;
 }
 
+ContainerResult container_array_sort_by_key(Array *array, const ByteSize key_offset, const ContainerSortKey key_type) {
+    if (!array) return CONTAINER_ERROR_INVALID_PARAM;
+    if (!(*array)->_memory_size) return CONTAINER_ERROR_NOT_ALLOCATED;
+    if (!(*array)->_size) return CONTAINER_ERROR_EMPTY_DATA;
+
+    ByteSize key_width_ = _container_array_sort_key_width(key_type);
+    if (!key_width_ || (key_offset + key_width_ > (*array)->_data_size)) return CONTAINER_ERROR_INVALID_PARAM;
+
+    ByteSize size_      = (*array)->_size;
+    ByteSize data_size_ = (*array)->_data_size;
+    if (size_ < 2) return CONTAINER_SUCCESS;
+
+    // every digit's histogram comes out of a single read over the keys
+    ByteSize counts_[sizeof(UInt64)][256] = {0};
+    BytePtr  src_                         = (*array)->_pool;
+
+    for (ByteSize i = 0; i < size_; ++i) {
+        UInt64 key_ = _container_array_sort_key(src_ + (i * data_size_) + key_offset, key_type);
+        for (ByteSize digit = 0; digit < key_width_; ++digit) ++counts_[digit][(key_ >> (digit * 8)) & 0xFF];
+    }
+
+    BytePtr  dst_       = NULL;
+    VoidPtr  temp_      = NULL;
+    ByteSize temp_size_ = 0;
+    UInt64   first_key_ = _container_array_sort_key(src_ + key_offset, key_type);
+
+    for (ByteSize digit = 0; digit < key_width_; ++digit) {
+        ByteSize *counts_digit_ = counts_[digit];
+        ByteSize  shift_        = digit * 8;
+
+        // all the keys share this digit, the pass would not move anything
+        if (counts_digit_[(first_key_ >> shift_) & 0xFF] == size_) continue;
+
+        if (!temp_) {
+            if (memory_zone_allocate(MEMORY_ZONE_CONTAINERS, size_ * data_size_, &temp_, &temp_size_) != MEMORY_ZONE_SUCCESS)
+                return CONTAINER_ERROR_ALLOCATION_FAILED;
+
+            dst_ = temp_;
+        }
+
+        ByteSize offsets_[256];
+        ByteSize offset_ = 0;
+
+        for (ByteSize bucket = 0; bucket < 256; ++bucket) {
+            offsets_[bucket] = offset_;
+            offset_ += counts_digit_[bucket];
+        }
+
+        for (ByteSize i = 0; i < size_; ++i) {
+            BytePtr element_ = src_ + (i * data_size_);
+            UInt64  key_     = _container_array_sort_key(element_ + key_offset, key_type);
+
+            memcpy(dst_ + (offsets_[(key_ >> shift_) & 0xFF]++ * data_size_), element_, data_size_);
+        }
+
+        BytePtr swap_ = src_;
+        src_          = dst_;
+        dst_          = swap_;
+    }
+
+    // an odd number of passes leaves the result in the scratch buffer
+    if (src_ != (*array)->_pool) memcpy((*array)->_pool, src_, size_ * data_size_);
+
+    if (temp_ && (memory_zone_deallocate(MEMORY_ZONE_CONTAINERS, temp_, temp_size_) != MEMORY_ZONE_SUCCESS))
+        return CONTAINER_ERROR_DEALLOCATION_FAILED;
+
+    return CONTAINER_SUCCESS;
+}
+
+ContainerResult container_array_sort_parallel(Array *array, Int32 (*compare)(const void *left, const void *right)) {
+    if (!array || !compare) return CONTAINER_ERROR_INVALID_PARAM;
+    if (!(*array)->_memory_size) return CONTAINER_ERROR_NOT_ALLOCATED;
+    if (!(*array)->_size) return CONTAINER_ERROR_EMPTY_DATA;
+
+    ByteSize size_      = (*array)->_size;
+    ByteSize data_size_ = (*array)->_data_size;
+
+    // not worth starting threads for
+    if ((size_ < CONTAINER_SORT_PARALLEL_THRESHOLD) || (CONTAINER_SORT_THREADS < 2)) {
+        if (size_ > 1) qsort((*array)->_pool, size_, data_size_, compare);
+        return CONTAINER_SUCCESS;
+    }
+
+    VoidPtr  temp_      = NULL;
+    ByteSize temp_size_ = 0;
+
+    if (memory_zone_allocate(MEMORY_ZONE_CONTAINERS, size_ * data_size_, &temp_, &temp_size_) != MEMORY_ZONE_SUCCESS)
+        return CONTAINER_ERROR_ALLOCATION_FAILED;
+
+    ContainerArraySortShared shared_ = {
+        ._pool      = (*array)->_pool,
+        ._temp      = temp_,
+        ._data_size = data_size_,
+        ._size      = size_,
+        ._compare   = compare,
+    };
+
+    ContainerArraySortWorker workers_[CONTAINER_SORT_THREADS];
+    PlatformThread           threads_[CONTAINER_SORT_THREADS];
+    ByteSize                 count_ = 1;
+
+    for (ByteSize i = 0; i < CONTAINER_SORT_THREADS; ++i) workers_[i] = (ContainerArraySortWorker){._shared = &shared_, ._index = i};
+
+    // the calling thread is worker 0; a thread that fails to start just leaves the work to fewer of them
+    while ((count_ < CONTAINER_SORT_THREADS) && (platform_thread_create(&threads_[count_], _container_array_sort_worker, &workers_[count_]) == PLATFORM_THREAD_SUCCESS))
+        ++count_;
+
+    shared_._count = count_;
+    shared_._chunk = (size_ + count_ - 1) / count_;
+    __atomic_store_n(&shared_._gate, true, __ATOMIC_RELEASE);
+
+    _container_array_sort_worker(&workers_[0]);
+
+    for (ByteSize i = 1; i < count_; ++i) platform_thread_join(&threads_[i]);
+
+    if (memory_zone_deallocate(MEMORY_ZONE_CONTAINERS, temp_, temp_size_) != MEMORY_ZONE_SUCCESS)
+        return CONTAINER_ERROR_DEALLOCATION_FAILED;
+
+    return CONTAINER_SUCCESS;
+}
+
 ByteSize container_array_data_size(Array array) {
     return (!array) ? 0 : array->_data_size;
 }
@@ -250,3 +697,54 @@ Bool container_array_empty(Array array) {
 Bool container_array_full(Array array) {
     return (!array) ? false : (array->_size == array->_capacity);
 }
+
+// ---------------------------------------------------------------------- //
+
+ContainerResult container_array_typed_reserve(VoidPtr *data, const ByteSize data_size, const ByteSize alignment, const ByteSize count, ByteSize *capacity, ByteSize *memory_size) {
+    if (!data || !data_size || !capacity || !memory_size) return CONTAINER_ERROR_INVALID_PARAM;
+    if (!alignment || (alignment & (alignment - 1))) return CONTAINER_ERROR_INVALID_PARAM;
+    if (count <= *capacity) return CONTAINER_SUCCESS;
+
+    Bool     over_aligned_   = (alignment > MEMORY_ALIGNMENT_SIZE);
+    ByteSize new_alloc_size_ = 0;
+
+    // extending keeps the elements where they are, so there is nothing to copy; it only knows blocks
+    // laid out at the zone's own alignment
+    if (*data && !over_aligned_ && (memory_zone_extend(MEMORY_ZONE_CONTAINERS, *data, *memory_size, data_size * count, &new_alloc_size_) == MEMORY_ZONE_SUCCESS)) {
+        *capacity    = new_alloc_size_ / data_size;
+        *memory_size = new_alloc_size_;
+        return CONTAINER_SUCCESS;
+    }
+
+    VoidPtr new_data_ = NULL;
+    if (memory_zone_allocate_aligned(MEMORY_ZONE_CONTAINERS, data_size * count, alignment, &new_data_, &new_alloc_size_) != MEMORY_ZONE_SUCCESS)
+        return CONTAINER_ERROR_ALLOCATION_FAILED;
+
+    // an over-aligned block starts at an offset into the zone's, so it is handed back by the size asked for
+    if (over_aligned_) new_alloc_size_ = data_size * count;
+
+    if (*data) {
+        memcpy(new_data_, *data, data_size * (*capacity));
+
+        // the array keeps its old block, so the new one goes back
+        if (memory_zone_deallocate_aligned(MEMORY_ZONE_CONTAINERS, *data, *memory_size, alignment) != MEMORY_ZONE_SUCCESS) {
+            memory_zone_deallocate_aligned(MEMORY_ZONE_CONTAINERS, new_data_, new_alloc_size_, alignment);
+            return CONTAINER_ERROR_DEALLOCATION_FAILED;
+        }
+    }
+
+    *data        = new_data_;
+    *capacity    = new_alloc_size_ / data_size;
+    *memory_size = new_alloc_size_;
+
+    return CONTAINER_SUCCESS;
+}
+
+ContainerResult container_array_typed_release(VoidPtr data, const ByteSize alignment, const ByteSize memory_size) {
+    if (!data) return CONTAINER_SUCCESS;
+
+    if (memory_zone_deallocate_aligned(MEMORY_ZONE_CONTAINERS, data, memory_size, alignment) != MEMORY_ZONE_SUCCESS)
+        return CONTAINER_ERROR_DEALLOCATION_FAILED;
+
+    return CONTAINER_SUCCESS;
+}
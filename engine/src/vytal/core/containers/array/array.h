@@ -8,13 +8,25 @@ VYTAL_API ContainerResult container_array_construct(const ByteSize data_size, Ar
 VYTAL_API ContainerResult container_array_destruct(Array array);
 
 VYTAL_API ContainerResult container_array_push(Array *array, VoidPtr new_data);
+VYTAL_API ContainerResult container_array_push_many(Array *array, const VoidPtr data, const ByteSize count);
 VYTAL_API ContainerResult container_array_pop(Array *array);
 VYTAL_API ContainerResult container_array_insert(Array *array, const ByteSize index, VoidPtr new_data);
 VYTAL_API ContainerResult container_array_remove(Array *array, const VoidPtr data, const Bool remove_all);
 VYTAL_API ContainerResult container_array_remove_at_index(Array *array, const ByteSize index);
+VYTAL_API ContainerResult container_array_swap_remove(Array *array, const ByteSize index);
+VYTAL_API ContainerResult container_array_reserve(Array *array, const ByteSize count);
+VYTAL_API ContainerResult container_array_resize(Array *array, const ByteSize new_size, const Bool zeroed);
 VYTAL_API ContainerResult container_array_clear(Array *array);
 VYTAL_API ContainerResult container_array_sort(Array *array, Int32 (*compare)(const void *left, const void *right));
 
+// stable LSD radix sort on the key stored key_offset bytes into every element; no comparator calls, and
+// passes whose digit is the same for every element are skipped
+VYTAL_API ContainerResult container_array_sort_by_key(Array *array, const ByteSize key_offset, const ContainerSortKey key_type);
+
+// merge sort split over CONTAINER_SORT_THREADS threads once the array holds CONTAINER_SORT_PARALLEL_THRESHOLD
+// elements (qsort below that); compare is called from several threads at once
+VYTAL_API ContainerResult container_array_sort_parallel(Array *array, Int32 (*compare)(const void *left, const void *right));
+
 VYTAL_API ByteSize container_array_data_size(Array array);
 VYTAL_API ByteSize container_array_size(Array array);
 VYTAL_API ByteSize container_array_capacity(Array array);
@@ -22,3 +34,53 @@ VYTAL_API VoidPtr  container_array_get(Array array);
 VYTAL_API VoidPtr  container_array_at_index(Array array, const ByteSize index);
 VYTAL_API Bool     container_array_empty(Array array);
 VYTAL_API Bool     container_array_full(Array array);
+
+// typed arrays ---------------------------------------------------------- //
+
+// a typed array is a plain struct held by value in its owner (typedef VT_ARRAY(Vertex) VertexArray;), zeroed to start
+// out empty; elements are indexed directly and only growth leaves the header, extending the block in place when it
+// can. the macros take the array as an lvalue and evaluate it more than once
+#define VT_ARRAY(T)            \
+    struct {                   \
+        T       *_data;        \
+        ByteSize _size;        \
+        ByteSize _capacity;    \
+        ByteSize _memory_size; \
+    }
+
+#define VT_ARRAY_AT(array, index) ((array)._data[index])
+#define VT_ARRAY_DATA(array) ((array)._data)
+#define VT_ARRAY_COUNT(array) ((array)._size)
+#define VT_ARRAY_CAPACITY(array) ((array)._capacity)
+#define VT_ARRAY_EMPTY(array) (!(array)._size)
+#define VT_ARRAY_POP(array) (--(array)._size)
+#define VT_ARRAY_CLEAR(array) ((array)._size = 0)
+#define VT_ARRAY_SWAP_REMOVE(array, index) ((array)._data[index] = (array)._data[--(array)._size])
+
+#define VT_ARRAY_RESERVE(array, count) ({                                                                                                                                         \
+    VoidPtr         _vt_data    = (array)._data;                                                                                                                                  \
+    ContainerResult _vt_reserve = container_array_typed_reserve(&_vt_data, sizeof(*(array)._data), _Alignof(*(array)._data), (count), &(array)._capacity, &(array)._memory_size); \
+    (array)._data               = _vt_data;                                                                                                                                       \
+    _vt_reserve;                                                                                                                                                                  \
+})
+
+#define VT_ARRAY_PUSH(array, value) ({                                                                                                    \
+    ContainerResult _vt_push = CONTAINER_SUCCESS;                                                                                         \
+    if ((array)._size == (array)._capacity)                                                                                               \
+        _vt_push = VT_ARRAY_RESERVE(array, (array)._capacity ? (array)._capacity * CONTAINER_RESIZE_FACTOR : CONTAINER_DEFAULT_CAPACITY); \
+    if (_vt_push == CONTAINER_SUCCESS) (array)._data[(array)._size++] = (value);                                                          \
+    _vt_push;                                                                                                                             \
+})
+
+#define VT_ARRAY_DESTRUCT(array) ({                                                                                             \
+    ContainerResult _vt_release = container_array_typed_release((array)._data, _Alignof(*(array)._data), (array)._memory_size); \
+    if (_vt_release == CONTAINER_SUCCESS) {                                                                                     \
+        (array)._data = NULL;                                                                                                   \
+        (array)._size = (array)._capacity = (array)._memory_size = 0;                                                           \
+    }                                                                                                                           \
+    _vt_release;                                                                                                                \
+})
+
+// used by the macros above, which pass the element alignment along; capacity and memory_size are only written on success
+VYTAL_API ContainerResult container_array_typed_reserve(VoidPtr *data, const ByteSize data_size, const ByteSize alignment, const ByteSize count, ByteSize *capacity, ByteSize *memory_size);
+VYTAL_API ContainerResult container_array_typed_release(VoidPtr data, const ByteSize alignment, const ByteSize memory_size);
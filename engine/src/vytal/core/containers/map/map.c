@@ -5,57 +5,401 @@
 #include <stdlib.h>
 #include <string.h>
 
+#if defined(__AVX2__) || defined(__SSE2__)
+#    include <immintrin.h>
+#endif
+
 #include "vytal/core/containers/string/string.h"
 #include "vytal/core/hash/hash.h"
 #include "vytal/core/memory/zone/memory_zone.h"
 
-#define TOMBSTONE_HASHED_KEY ((HashedInt)(-1))
-#define MAX_PROBE_LENGTH(capacity) ((capacity * 3) / 5)  // 60% of map capacity
+// control bytes are scanned a group at a time; the table never gets smaller than one group
+#if defined(__AVX2__)
+#    define MAP_GROUP_WIDTH 32
+#else
+#    define MAP_GROUP_WIDTH 16
+#endif
+
+// a full slot keeps 7 bits of its hash in the control byte, an empty one has the high bit set
+#define MAP_CTRL_EMPTY ((UInt8)0x80)
+#define MAP_CTRL_TAG(hashed_key) ((UInt8)((hashed_key) >> 57))
+
+// keys shorter than this live in the slot itself, longer ones in a string
+#define MAP_INLINE_KEY_SIZE 32
+
+// both slot layouts start with the mixed hash, which is all the table itself needs
+typedef struct Container_Map_Entry {
+    HashedInt _hashed_key;
+    ByteSize  _key_length;
+
+    union {
+        Char   _inline[MAP_INLINE_KEY_SIZE];
+        String _string;
+    } _key;
+} MapEntry;  // followed by the data
 
-typedef struct Container_Map_Data_Item {
-    String    _key;
+typedef struct Container_Map_Id_Entry {
     HashedInt _hashed_key;
-    UIntPtr   _pdata;
-} MapDataItem;
+    UInt64    _key;
+} MapIdEntry;  // followed by the data
 
 struct Container_Map {
-    VoidPtr  _pool;
+    UInt8   *_ctrl;  // one byte per slot, the first group mirrored past the end for wrapping loads
+    VoidPtr  _entries;
+    ByteSize _entry_size;
+    ByteSize _data_offset;
+    ByteSize _data_size;
+    ByteSize _size;
+    ByteSize _capacity;  // power of two
+
+    // used for allocations/deallocations
+    ByteSize _memory_size;
+};
+
+// id maps run on the same table, only their slots differ
+struct Container_Id_Map {
+    struct Container_Map _table;
+};
+
+// ordered maps keep their entries dense and in insertion order; the table only maps keys to positions
+typedef struct Container_Map_Index_Entry {
+    HashedInt _hashed_key;
+    ByteSize  _position;
+} MapIndexEntry;
+
+// key length of a removed entry, whose position stays a hole until the entries are compacted
+#define MAP_REMOVED_KEY_LENGTH ((ByteSize)-1)
+
+struct Container_Ordered_Map {
+    Map      _index;
+    VoidPtr  _entries;
+    ByteSize _entry_size;
     ByteSize _data_size;
+    ByteSize _count;  // positions in use, holes included
     ByteSize _size;
     ByteSize _capacity;
 
     // used for allocations/deallocations
+    ByteSize _entries_memory_size;
     ByteSize _memory_size;
 };
 
-ContainerResult _container_map_rehash_insert(Map *map, MapDataItem *old_slot) {
-    if (!map) return CONTAINER_ERROR_INVALID_PARAM;
-    if (!(*map)->_memory_size) return CONTAINER_ERROR_NOT_ALLOCATED;
+// concurrent maps split their keys over shards, each a table of its own behind a writer lock; readers
+// never lock, they check the shard's sequence instead and retry if a writer got in between
+#define MAP_CACHE_LINE_SIZE 64
+
+typedef union Container_Concurrent_Map_Shard {
+    struct {
+        Map             _table;     // swapped whole on resize
+        volatile UInt64 _sequence;  // odd while a writer changes the table
+        volatile Int32  _lock;
+        VoidPtr         _retired;  // tables and key strings a reader may still be looking at
+    };
+    UInt8 _line[MAP_CACHE_LINE_SIZE];
+} ConcurrentMapShard;
+
+typedef union Container_Concurrent_Map_Reader {
+    volatile UInt64 _epoch;  // epoch the reader entered in, 0 while it is outside
+    UInt8           _line[MAP_CACHE_LINE_SIZE];
+} ConcurrentMapReader;
+
+typedef struct Container_Concurrent_Map_Retired {
+    struct Container_Concurrent_Map_Retired *_next;
+    VoidPtr                                  _ptr;
+    UInt64                                   _epoch;
+    Bool                                     _is_table;
+} ConcurrentMapRetired;
+
+struct Container_Concurrent_Map {
+    ConcurrentMapShard  _shards[CONTAINER_CONCURRENT_MAP_SHARDS];
+    ConcurrentMapReader _readers[CONTAINER_CONCURRENT_MAP_READERS];
+    volatile UInt64     _epoch;
+    ByteSize            _data_size;
+
+    // used for allocations/deallocations
+    ByteSize _memory_size;
+};
+
+// reader slots are shared by all concurrent maps; threads past CONTAINER_CONCURRENT_MAP_READERS
+// (and slots of exited threads, which are never recycled) read under the shard lock instead
+static VYTAL_THREAD_LOCAL Int32 map_reader_slot  = -1;
+static volatile Int32           map_reader_count = 0;
+
+VYTAL_INLINE UInt32 _container_map_ctz(UInt32 mask) {
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_ctz(mask);
+
+#elif defined(_MSC_VER)
+    unsigned long index_;
+    _BitScanForward(&index_, mask);
+    return (UInt32)index_;
+
+#else
+    UInt32 count_ = 0;
+    while ((mask & 1) == 0) {
+        mask >>= 1;
+        ++count_;
+    }
+
+    return count_;
+#endif
+}
+
+// bit i of the result is set if the i-th control byte of the group holds the tag; empty slots go to out_empty
+VYTAL_INLINE UInt32 _container_map_group_match(const UInt8 *ctrl, const UInt8 tag, UInt32 *out_empty) {
+#if defined(__AVX2__)
+    __m256i group_ = _mm256_loadu_si256((const __m256i *)ctrl);
+    *out_empty     = (UInt32)_mm256_movemask_epi8(group_);
+
+    return (UInt32)_mm256_movemask_epi8(_mm256_cmpeq_epi8(group_, _mm256_set1_epi8((char)tag)));
+
+#elif defined(__SSE2__)
+    __m128i group_ = _mm_loadu_si128((const __m128i *)ctrl);
+    *out_empty     = (UInt32)_mm_movemask_epi8(group_);
+
+    return (UInt32)_mm_movemask_epi8(_mm_cmpeq_epi8(group_, _mm_set1_epi8((char)tag)));
+
+#else
+    UInt32 match_ = 0;
+    *out_empty    = 0;
+
+    for (UInt32 i = 0; i < MAP_GROUP_WIDTH; ++i) {
+        if (ctrl[i] == tag) match_ |= (1u << i);
+        if (ctrl[i] & MAP_CTRL_EMPTY) *out_empty |= (1u << i);
+    }
+
+    return match_;
+#endif
+}
+
+// matches of the group that lie before its first empty slot; the ones past it belong to other chains
+VYTAL_INLINE UInt32 _container_map_chain_matches(const UInt32 match, const UInt32 empty) {
+    return empty ? (match & ((empty & (~empty + 1)) - 1)) : match;
+}
+
+VYTAL_INLINE UInt32 _container_map_group_empty(const UInt8 *ctrl) {
+#if defined(__AVX2__)
+    return (UInt32)_mm256_movemask_epi8(_mm256_loadu_si256((const __m256i *)ctrl));
+
+#elif defined(__SSE2__)
+    return (UInt32)_mm_movemask_epi8(_mm_loadu_si128((const __m128i *)ctrl));
+
+#else
+    UInt32 empty_ = 0;
+    for (UInt32 i = 0; i < MAP_GROUP_WIDTH; ++i)
+        if (ctrl[i] & MAP_CTRL_EMPTY) empty_ |= (1u << i);
+
+    return empty_;
+#endif
+}
+
+// FNV-1a spreads poorly into the low bits and ids are often sequential, so every hash goes through
+// a finalizer before picking the home slot and the tag
+VYTAL_INLINE HashedInt _container_map_mix(HashedInt hashed_key) {
+    hashed_key ^= hashed_key >> 33;
+    hashed_key *= 0xff51afd7ed558ccdull;
+    hashed_key ^= hashed_key >> 33;
+    hashed_key *= 0xc4ceb9fe1a85ec53ull;
+    hashed_key ^= hashed_key >> 33;
+
+    return hashed_key;
+}
+
+VYTAL_INLINE VoidPtr _container_map_slot(Map map, const ByteSize index) {
+    return (VoidPtr)((BytePtr)map->_entries + (index * map->_entry_size));
+}
+
+VYTAL_INLINE VoidPtr _container_map_slot_data(Map map, VoidPtr slot) {
+    return (VoidPtr)((BytePtr)slot + map->_data_offset);
+}
+
+VYTAL_INLINE ByteSize _container_map_slot_index(Map map, VoidPtr slot) {
+    return (ByteSize)((BytePtr)slot - (BytePtr)map->_entries) / map->_entry_size;
+}
+
+// first occupied slot at or after index (capacity if there is none), found a group of control bytes at a time
+VYTAL_INLINE ByteSize _container_map_next_occupied(Map map, ByteSize index) {
+    for (; index < map->_capacity; index += MAP_GROUP_WIDTH) {
+        UInt32 full_ = ~_container_map_group_empty(map->_ctrl + index);
+
+#if MAP_GROUP_WIDTH < 32
+        full_ &= (1u << MAP_GROUP_WIDTH) - 1;
+#endif
+
+        // bits past the capacity are the mirrored first group, which was walked already
+        if (full_) return ((index + _container_map_ctz(full_)) < map->_capacity) ? (index + _container_map_ctz(full_)) : map->_capacity;
+    }
+
+    return map->_capacity;
+}
+
+// the first empty slot of the chain that starts at the hash's home slot
+VYTAL_INLINE ByteSize _container_map_find_empty(Map map, const HashedInt hashed_key) {
+    ByteSize mask_  = map->_capacity - 1;
+    ByteSize index_ = hashed_key & mask_;
+
+    while (!(map->_ctrl[index_] & MAP_CTRL_EMPTY))
+        index_ = (index_ + 1) & mask_;
+
+    return index_;
+}
+
+VYTAL_INLINE ConstStr _container_map_entry_key(MapEntry *entry) {
+    return (entry->_key_length < MAP_INLINE_KEY_SIZE) ? entry->_key._inline : container_string_get(entry->_key._string);
+}
+
+// long keys are compared a vector at a time, the rest (and inline keys) byte-wise
+VYTAL_INLINE Bool _container_map_key_equals(ConstStr left, ConstStr right, const ByteSize length) {
+    ByteSize idx_ = 0;
+
+#if defined(__AVX2__)
+    for (; idx_ + 32 <= length; idx_ += 32) {
+        __m256i chunk_left_  = _mm256_loadu_si256((const __m256i *)(left + idx_));
+        __m256i chunk_right_ = _mm256_loadu_si256((const __m256i *)(right + idx_));
+
+        if ((UInt32)_mm256_movemask_epi8(_mm256_cmpeq_epi8(chunk_left_, chunk_right_)) != 0xFFFFFFFFu) return false;
+    }
+#endif
+#if defined(__SSE2__)
+    for (; idx_ + 16 <= length; idx_ += 16) {
+        __m128i chunk_left_  = _mm_loadu_si128((const __m128i *)(left + idx_));
+        __m128i chunk_right_ = _mm_loadu_si128((const __m128i *)(right + idx_));
+
+        if (_mm_movemask_epi8(_mm_cmpeq_epi8(chunk_left_, chunk_right_)) != 0xFFFF) return false;
+    }
+#endif
+
+    return !memcmp(left + idx_, right + idx_, length - idx_);
+}
+
+VYTAL_INLINE void _container_map_set_ctrl(Map map, const ByteSize index, const UInt8 ctrl) {
+    map->_ctrl[index] = ctrl;
+    if (index < MAP_GROUP_WIDTH) map->_ctrl[map->_capacity + index] = ctrl;
+}
+
+VYTAL_INLINE ByteSize _container_map_ctrl_size(const ByteSize capacity) {
+    return VYTAL_APPLY_ALIGNMENT(capacity + MAP_GROUP_WIDTH, MEMORY_ALIGNMENT_SIZE);
+}
+
+VYTAL_INLINE ByteSize _container_map_default_capacity(void) {
+    ByteSize capacity_ = MAP_GROUP_WIDTH;
+    while (capacity_ < CONTAINER_DEFAULT_CAPACITY) capacity_ <<= 1;
+
+    return capacity_;
+}
+
+// smallest capacity that holds count entries without crossing the load factor
+VYTAL_INLINE ByteSize _container_map_capacity_for(const ByteSize count) {
+    ByteSize capacity_ = MAP_GROUP_WIDTH;
+    while (count > (capacity_ * 3) / 4) capacity_ <<= 1;
+
+    return capacity_;
+}
+
+// linear probing: the chain of a key runs from its home slot to the first empty one
+MapEntry *_container_map_find(Map map, const HashedInt hashed_key, ConstStr key, const ByteSize key_length, ByteSize *out_empty_index) {
+    ByteSize mask_ = map->_capacity - 1;
+    ByteSize pos_  = hashed_key & mask_;
+    UInt8    tag_  = MAP_CTRL_TAG(hashed_key);
+
+    for (;;) {
+        UInt32 empty_ = 0;
+        UInt32 match_ = _container_map_group_match(map->_ctrl + pos_, tag_, &empty_);
+        match_        = _container_map_chain_matches(match_, empty_);
+
+        // the tag filters the group, the full hash and length filter the slot; equal hashes alone
+        // never make a match, so colliding keys stay distinct
+        while (match_) {
+            MapEntry *entry_ = _container_map_slot(map, (pos_ + _container_map_ctz(match_)) & mask_);
+
+            if ((entry_->_hashed_key == hashed_key) && (entry_->_key_length == key_length) &&
+                _container_map_key_equals(_container_map_entry_key(entry_), key, key_length))
+                return entry_;
+
+            match_ &= match_ - 1;
+        }
+
+        // the load factor keeps at least one slot empty, so every chain ends
+        if (empty_) {
+            if (out_empty_index) *out_empty_index = (pos_ + _container_map_ctz(empty_)) & mask_;
+            return NULL;
+        }
+
+        pos_ = (pos_ + MAP_GROUP_WIDTH) & mask_;
+    }
+}
+
+MapIdEntry *_container_map_find_id(Map map, const HashedInt hashed_key, const UInt64 key, ByteSize *out_empty_index) {
+    ByteSize mask_ = map->_capacity - 1;
+    ByteSize pos_  = hashed_key & mask_;
+    UInt8    tag_  = MAP_CTRL_TAG(hashed_key);
+
+    for (;;) {
+        UInt32 empty_ = 0;
+        UInt32 match_ = _container_map_group_match(map->_ctrl + pos_, tag_, &empty_);
+        match_        = _container_map_chain_matches(match_, empty_);
 
-    ByteSize     idx_          = old_slot->_hashed_key % (*map)->_capacity;
-    ByteSize     check_offset_ = (sizeof(MapDataItem) + (*map)->_data_size) * idx_;
-    MapDataItem *check_slot_   = (MapDataItem *)((BytePtr)(*map)->_pool + check_offset_);
+        while (match_) {
+            MapIdEntry *entry_ = _container_map_slot(map, (pos_ + _container_map_ctz(match_)) & mask_);
+            if (entry_->_key == key) return entry_;
 
-    ByteSize probe_ = 1;
-    while (check_slot_->_hashed_key != 0) {
-        // perform double-hashing probe
-        UInt64 hash2_ = old_slot->_hashed_key;
-        idx_          = (idx_ + (probe_ * hash2_)) % (*map)->_capacity;
+            match_ &= match_ - 1;
+        }
 
-        check_offset_ = (sizeof(MapDataItem) + (*map)->_data_size) * idx_;
-        check_slot_   = (MapDataItem *)((BytePtr)(*map)->_pool + check_offset_);
+        if (empty_) {
+            if (out_empty_index) *out_empty_index = (pos_ + _container_map_ctz(empty_)) & mask_;
+            return NULL;
+        }
 
-        ++probe_;
+        pos_ = (pos_ + MAP_GROUP_WIDTH) & mask_;
     }
+}
 
-    check_slot_->_hashed_key = old_slot->_hashed_key;
+ContainerResult _container_map_allocate(const ByteSize data_offset, const ByteSize data_size, const ByteSize capacity, Map *out_map) {
+    ByteSize entry_size_ = data_offset + VYTAL_APPLY_ALIGNMENT(data_size, sizeof(VoidPtr));
+    ByteSize ctrl_size_  = _container_map_ctrl_size(capacity);
+    ByteSize alloc_size_ = VYTAL_APPLY_ALIGNMENT(sizeof(struct Container_Map), MEMORY_ALIGNMENT_SIZE) + ctrl_size_ + (entry_size_ * capacity);
 
-    if (container_string_construct(container_string_get(old_slot->_key), &check_slot_->_key) != CONTAINER_SUCCESS)
+    Map map_ = NULL;
+    if (memory_zone_allocate_zeroed(MEMORY_ZONE_CONTAINERS, alloc_size_, (VoidPtr *)&map_, &alloc_size_) != MEMORY_ZONE_SUCCESS)
         return CONTAINER_ERROR_ALLOCATION_FAILED;
 
-    check_slot_->_pdata = (UIntPtr)((BytePtr)check_slot_ + sizeof(MapDataItem));
-    memmove((VoidPtr)check_slot_->_pdata, (VoidPtr)old_slot->_pdata, (*map)->_data_size);
+    map_->_ctrl        = (UInt8 *)((UIntPtr)map_ + VYTAL_APPLY_ALIGNMENT(sizeof(struct Container_Map), MEMORY_ALIGNMENT_SIZE));
+    map_->_entries     = (VoidPtr)((UIntPtr)map_->_ctrl + ctrl_size_);
+    map_->_entry_size  = entry_size_;
+    map_->_data_offset = data_offset;
+    map_->_data_size   = data_size;
+    map_->_size        = 0;
+    map_->_capacity    = capacity;
+    map_->_memory_size = alloc_size_;
+
+    memset(map_->_ctrl, MAP_CTRL_EMPTY, capacity + MAP_GROUP_WIDTH);
+
+    *out_map = map_;
+    return CONTAINER_SUCCESS;
+}
+
+// entries move as they are, so long keys keep their strings; the old table is left as it was
+ContainerResult _container_map_rehash(Map old_map, const ByteSize new_capacity, Map *out_new_map) {
+    Map new_map_ = NULL;
+
+    ContainerResult allocate_ = _container_map_allocate(old_map->_data_offset, old_map->_data_size, new_capacity, &new_map_);
+    if (allocate_ != CONTAINER_SUCCESS)
+        return allocate_;
+
+    for (ByteSize i = 0; i < old_map->_capacity; ++i) {
+        if (old_map->_ctrl[i] & MAP_CTRL_EMPTY) continue;
+
+        VoidPtr  old_slot_ = _container_map_slot(old_map, i);
+        ByteSize index_    = _container_map_find_empty(new_map_, *(HashedInt *)old_slot_);
 
+        _container_map_set_ctrl(new_map_, index_, old_map->_ctrl[i]);
+        memcpy(_container_map_slot(new_map_, index_), old_slot_, old_map->_entry_size);
+    }
+
+    new_map_->_size = old_map->_size;
+
+    *out_new_map = new_map_;
     return CONTAINER_SUCCESS;
 }
 
@@ -66,278 +410,244 @@ ContainerResult _container_map_resize(Map *map, const ByteSize new_capacity) {
     Map old_map_ = *map;
     Map new_map_ = NULL;
 
-    ByteSize item_size_           = sizeof(MapDataItem) + old_map_->_data_size;
-    ByteSize base_new_alloc_size_ = old_map_->_memory_size * CONTAINER_RESIZE_FACTOR;
-    ByteSize new_alloc_size_      = 0;
+    ContainerResult rehash_ = _container_map_rehash(old_map_, new_capacity, &new_map_);
+    if (rehash_ != CONTAINER_SUCCESS)
+        return rehash_;
 
-    if (memory_zone_allocate("containers", base_new_alloc_size_, (VoidPtr *)&new_map_, &new_alloc_size_) != MEMORY_ZONE_SUCCESS)
-        return CONTAINER_ERROR_ALLOCATION_FAILED;
-    memset(new_map_, 0, new_alloc_size_);
+    if (memory_zone_deallocate(MEMORY_ZONE_CONTAINERS, old_map_, old_map_->_memory_size) != MEMORY_ZONE_SUCCESS)
+        return CONTAINER_ERROR_DEALLOCATION_FAILED;
 
-    new_map_->_data_size   = old_map_->_data_size;
-    new_map_->_size        = old_map_->_size;
-    new_map_->_capacity    = new_capacity;
-    new_map_->_memory_size = new_alloc_size_;
-    new_map_->_pool        = (VoidPtr)((UIntPtr)new_map_ + sizeof(struct Container_Map));
+    *map = new_map_;
 
-    for (ByteSize i = 0; i < old_map_->_capacity; ++i) {
-        ByteSize     old_slot_offset_ = i * item_size_;
-        MapDataItem *old_slot_        = (MapDataItem *)((BytePtr)old_map_->_pool + old_slot_offset_);
+    return CONTAINER_SUCCESS;
+}
 
-        if (old_slot_->_hashed_key != 0 && old_slot_->_hashed_key != TOMBSTONE_HASHED_KEY) {
-            _container_map_rehash_insert(&new_map_, old_slot_);
+// handle container resizing (when map is 75% full)
+VYTAL_INLINE ContainerResult _container_map_reserve_slot(Map *map, Bool *out_resized) {
+    *out_resized = false;
+    if ((*map)->_size < ((*map)->_capacity * 3) / 4) return CONTAINER_SUCCESS;
 
-            if (container_string_destruct(old_slot_->_key) != CONTAINER_SUCCESS)
-                return CONTAINER_ERROR_DEALLOCATION_FAILED;
-        }
-    }
+    *out_resized = true;
+    return _container_map_resize(map, (*map)->_capacity * 2);
+}
 
-    if (memory_zone_deallocate("containers", old_map_, old_map_->_memory_size) != MEMORY_ZONE_SUCCESS)
-        return CONTAINER_ERROR_DEALLOCATION_FAILED;
+ContainerResult _container_map_reserve(Map *map, const ByteSize count) {
+    ByteSize capacity_ = _container_map_capacity_for(count);
+    if (capacity_ <= (*map)->_capacity) return CONTAINER_SUCCESS;
 
-    *map = new_map_;
+    return _container_map_resize(map, capacity_);
+}
 
-    return CONTAINER_SUCCESS;
+ContainerResult _container_map_shrink_to_fit(Map *map) {
+    ByteSize capacity_ = _container_map_capacity_for((*map)->_size);
+    if (capacity_ >= (*map)->_capacity) return CONTAINER_SUCCESS;
+
+    return _container_map_resize(map, capacity_);
 }
 
-ContainerResult container_map_construct(const ByteSize data_size, Map *out_new_map) {
-    if (!data_size) return CONTAINER_ERROR_INVALID_PARAM;
+// backward-shift deletion: pull every later entry of the cluster that may sit in the hole into it,
+// so chains stay unbroken without tombstones
+void _container_map_erase(Map map, VoidPtr slot) {
+    ByteSize mask_ = map->_capacity - 1;
+    ByteSize hole_ = _container_map_slot_index(map, slot);
 
-    ByteSize item_size_  = sizeof(MapDataItem) + data_size;
-    ByteSize pool_size_  = item_size_ * CONTAINER_DEFAULT_CAPACITY;
-    ByteSize alloc_size_ = VYTAL_APPLY_ALIGNMENT(sizeof(struct Container_Map) + pool_size_, MEMORY_ALIGNMENT_SIZE);
+    for (ByteSize next_ = (hole_ + 1) & mask_; !(map->_ctrl[next_] & MAP_CTRL_EMPTY); next_ = (next_ + 1) & mask_) {
+        VoidPtr  next_slot_ = _container_map_slot(map, next_);
+        ByteSize home_      = *(HashedInt *)next_slot_ & mask_;
 
-    if (memory_zone_allocate("containers", alloc_size_, (VoidPtr *)out_new_map, &alloc_size_) != MEMORY_ZONE_SUCCESS)
-        return CONTAINER_ERROR_ALLOCATION_FAILED;
-    memset(*out_new_map, 0, alloc_size_);
+        if (((next_ - home_) & mask_) < ((next_ - hole_) & mask_)) continue;
+
+        _container_map_set_ctrl(map, hole_, map->_ctrl[next_]);
+        memcpy(_container_map_slot(map, hole_), next_slot_, map->_entry_size);
+        hole_ = next_;
+    }
+
+    // empty slots stay zeroed for container_map_at_index()
+    _container_map_set_ctrl(map, hole_, MAP_CTRL_EMPTY);
+    memset(_container_map_slot(map, hole_), 0, map->_entry_size);
+    --map->_size;
+}
 
-    (*out_new_map)->_data_size   = data_size;
-    (*out_new_map)->_size        = 0;
-    (*out_new_map)->_capacity    = CONTAINER_DEFAULT_CAPACITY;
-    (*out_new_map)->_memory_size = alloc_size_;
-    (*out_new_map)->_pool        = (VoidPtr)((UIntPtr)(*out_new_map) + sizeof(struct Container_Map));
+// ---------------------------------------------------------------------- //
 
-    return CONTAINER_SUCCESS;
+ContainerResult container_map_construct(const ByteSize data_size, Map *out_new_map) {
+    if (!data_size || !out_new_map) return CONTAINER_ERROR_INVALID_PARAM;
+
+    return _container_map_allocate(sizeof(MapEntry), data_size, _container_map_default_capacity(), out_new_map);
 }
 
 ContainerResult container_map_destruct(Map map) {
     if (!map) return CONTAINER_ERROR_INVALID_PARAM;
-    if (!map->_pool || !map->_memory_size) return CONTAINER_ERROR_NOT_ALLOCATED;
+    if (!map->_memory_size) return CONTAINER_ERROR_NOT_ALLOCATED;
 
     for (ByteSize i = 0; i < map->_capacity; ++i) {
-        MapDataItem *slot_ = (MapDataItem *)((BytePtr)map->_pool + i * (sizeof(MapDataItem) + map->_data_size));
+        MapEntry *entry_ = _container_map_slot(map, i);
 
-        if ((slot_->_hashed_key != 0) && (slot_->_hashed_key != TOMBSTONE_HASHED_KEY)) {
-            if (container_string_destruct(slot_->_key) != CONTAINER_SUCCESS)
+        if (!(map->_ctrl[i] & MAP_CTRL_EMPTY) && (entry_->_key_length >= MAP_INLINE_KEY_SIZE)) {
+            if (container_string_destruct(entry_->_key._string) != CONTAINER_SUCCESS)
                 return CONTAINER_ERROR_DEALLOCATION_FAILED;
         }
     }
 
-    if (memory_zone_deallocate("containers", map, map->_memory_size) != MEMORY_ZONE_SUCCESS)
+    if (memory_zone_deallocate(MEMORY_ZONE_CONTAINERS, map, map->_memory_size) != MEMORY_ZONE_SUCCESS)
         return CONTAINER_ERROR_DEALLOCATION_FAILED;
 
-    memset(map, 0, map->_memory_size);
     return CONTAINER_SUCCESS;
 }
 
 ContainerResult container_map_insert(Map *map, ConstStr key, const VoidPtr data) {
+    return container_map_insert_hashed(map, hash_str(key, CONTAINER_MAP_HASH_MODE), key, data);
+}
+
+ContainerResult container_map_insert_hashed(Map *map, const HashedInt hashed_key, ConstStr key, const VoidPtr data) {
     if (!map || !key || !data) return CONTAINER_ERROR_INVALID_PARAM;
     if (!(*map)->_memory_size) return CONTAINER_ERROR_NOT_ALLOCATED;
 
-    // handle container resizing (when map is 75% full)
-    if ((*map)->_size >= ((*map)->_capacity * 3) / 4) {
-        ByteSize new_capacity_ = (*map)->_capacity * CONTAINER_RESIZE_FACTOR;
-
-        ContainerResult resize_result = _container_map_resize(map, new_capacity_);
-        if (resize_result != CONTAINER_SUCCESS)
-            return resize_result;
-    }
-
-    HashedInt    hashed_       = hash_str(key, HASH_MODE_XX64);
-    ByteSize     idx_          = hashed_ % (*map)->_capacity;
-    ByteSize     check_offset_ = (sizeof(MapDataItem) + (*map)->_data_size) * idx_;
-    MapDataItem *check_slot_   = (MapDataItem *)((BytePtr)((*map)->_pool) + check_offset_);
+    ByteSize  key_length_ = strlen(key);
+    HashedInt hashed_     = _container_map_mix(hashed_key);
+    ByteSize  index_      = 0;
 
-    ByteSize probe_        = 1;
-    ByteSize probe_length_ = 0;
+    if (_container_map_find(*map, hashed_, key, key_length_, &index_))
+        return CONTAINER_ERROR_MAP_KEY_ALREADY_EXISTS;
 
-    while ((check_slot_->_hashed_key != 0) && (check_slot_->_hashed_key != TOMBSTONE_HASHED_KEY)) {
-        // slot with matching hash already exists
-        if (check_slot_->_hashed_key == hashed_)
-            return CONTAINER_ERROR_MAP_KEY_ALREADY_EXISTS;
+    Bool            resized_ = false;
+    ContainerResult reserve_ = _container_map_reserve_slot(map, &resized_);
+    if (reserve_ != CONTAINER_SUCCESS)
+        return reserve_;
 
-        // perform double-hashing probing
-        UInt64 hash2_ = check_slot_->_hashed_key;
-        idx_          = (idx_ + (probe_ * hash2_)) % (*map)->_capacity;
+    if (resized_)
+        _container_map_find(*map, hashed_, key, key_length_, &index_);
 
-        check_offset_ = (sizeof(MapDataItem) + (*map)->_data_size) * idx_;
-        check_slot_   = (MapDataItem *)((BytePtr)((*map)->_pool) + check_offset_);
+    MapEntry *entry_ = _container_map_slot(*map, index_);
 
-        if (++probe_length_ > MAX_PROBE_LENGTH((*map)->_capacity)) {
-            // scam for any empty slot
-            for (ByteSize i = 0; i < (*map)->_capacity; ++i) {
-                check_offset_ = (sizeof(MapDataItem) + (*map)->_data_size) * i;
-                check_slot_   = (MapDataItem *)((BytePtr)((*map)->_pool) + check_offset_);
-
-                if (check_slot_->_hashed_key == 0 || check_slot_->_hashed_key == TOMBSTONE_HASHED_KEY) {
-                    idx_ = i;
-                    break;
-                }
-            }
-
-            if (check_slot_->_hashed_key != 0 && check_slot_->_hashed_key != TOMBSTONE_HASHED_KEY)
-                return CONTAINER_ERROR_MAP_REACHED_PROBING_LIMITS;
-        }
+    if (key_length_ < MAP_INLINE_KEY_SIZE)
+        memcpy(entry_->_key._inline, key, key_length_ + 1);
+    else if (container_string_construct(key, &entry_->_key._string) != CONTAINER_SUCCESS)
+        return CONTAINER_ERROR_ALLOCATION_FAILED;
 
-        ++probe_;
-    }
+    entry_->_hashed_key = hashed_;
+    entry_->_key_length = key_length_;
+    memcpy(_container_map_slot_data(*map, entry_), data, (*map)->_data_size);
 
-    // found available slot
-    {
-        Bool is_tombstone_ = (check_slot_->_hashed_key == TOMBSTONE_HASHED_KEY);
+    _container_map_set_ctrl(*map, index_, MAP_CTRL_TAG(hashed_));
+    ++(*map)->_size;
 
-        if (container_string_construct(key, &check_slot_->_key) != CONTAINER_SUCCESS)
-            return CONTAINER_ERROR_ALLOCATION_FAILED;
+    return CONTAINER_SUCCESS;
+}
 
-        check_slot_->_hashed_key = hashed_;
-        check_slot_->_pdata      = (UIntPtr)((BytePtr)check_slot_ + sizeof(MapDataItem));
+// sized once up front, so the inserts never resize on the way
+ContainerResult container_map_insert_many(Map *map, ConstStr *keys, const VoidPtr data, const ByteSize count) {
+    if (!map || !keys || !data) return CONTAINER_ERROR_INVALID_PARAM;
+    if (!(*map)->_memory_size) return CONTAINER_ERROR_NOT_ALLOCATED;
 
-        memmove((VoidPtr)check_slot_->_pdata, data, (*map)->_data_size);
+    ContainerResult reserve_ = _container_map_reserve(map, (*map)->_size + count);
+    if (reserve_ != CONTAINER_SUCCESS)
+        return reserve_;
 
-        if (!is_tombstone_) ++(*map)->_size;
+    for (ByteSize i = 0; i < count; ++i) {
+        VoidPtr         data_   = (VoidPtr)((BytePtr)data + (i * (*map)->_data_size));
+        ContainerResult insert_ = container_map_insert_hashed(map, hash_str(keys[i], CONTAINER_MAP_HASH_MODE), keys[i], data_);
+        if (insert_ != CONTAINER_SUCCESS)
+            return insert_;
     }
 
     return CONTAINER_SUCCESS;
 }
 
 ContainerResult container_map_remove(Map *map, ConstStr key) {
+    return container_map_remove_hashed(map, hash_str(key, CONTAINER_MAP_HASH_MODE), key);
+}
+
+ContainerResult container_map_remove_hashed(Map *map, const HashedInt hashed_key, ConstStr key) {
     if (!map || !key) return CONTAINER_ERROR_INVALID_PARAM;
     if (!(*map)->_memory_size) return CONTAINER_ERROR_NOT_ALLOCATED;
 
-    HashedInt    hashed_       = hash_str(key, HASH_MODE_XX64);
-    ByteSize     idx_          = hashed_ % (*map)->_capacity;
-    ByteSize     check_offset_ = (sizeof(MapDataItem) + (*map)->_data_size) * idx_;
-    MapDataItem *check_slot_   = (MapDataItem *)((BytePtr)((*map)->_pool) + check_offset_);
-
-    ByteSize probe_        = 1;
-    ByteSize probe_length_ = 0;
-    while (check_slot_->_hashed_key != 0) {
-        if (check_slot_->_hashed_key == TOMBSTONE_HASHED_KEY) {
-            // skip tombstone
-        } else {
-            // found matching slot
-            if (container_string_destruct(check_slot_->_key) != CONTAINER_SUCCESS)
-                return CONTAINER_ERROR_DEALLOCATION_FAILED;
-
-            check_slot_->_hashed_key = TOMBSTONE_HASHED_KEY;
-            check_slot_->_pdata      = 0;
-            --(*map)->_size;
-            return CONTAINER_SUCCESS;
-        }
-
-        if (++probe_length_ > MAX_PROBE_LENGTH((*map)->_capacity))
-            return CONTAINER_ERROR_MAP_REACHED_PROBING_LIMITS;  // failed due to excessive probing
+    MapEntry *entry_ = _container_map_find(*map, _container_map_mix(hashed_key), key, strlen(key), NULL);
+    if (!entry_) return CONTAINER_ERROR_MAP_KEY_NOT_FOUND;
 
-        // continue probing
-        {
-            UInt64 hash2_ = check_slot_->_hashed_key;
-            idx_          = (idx_ + (probe_ * hash2_)) % (*map)->_capacity;
-
-            check_offset_ = (sizeof(MapDataItem) + (*map)->_data_size) * idx_;
-            check_slot_   = (MapDataItem *)((BytePtr)((*map)->_pool) + check_offset_);
-        }
-
-        ++probe_;
-    }
+    if ((entry_->_key_length >= MAP_INLINE_KEY_SIZE) && (container_string_destruct(entry_->_key._string) != CONTAINER_SUCCESS))
+        return CONTAINER_ERROR_DEALLOCATION_FAILED;
 
-    return CONTAINER_ERROR_MAP_KEY_NOT_FOUND;
+    _container_map_erase(*map, entry_);
+    return CONTAINER_SUCCESS;
 }
 
 ContainerResult container_map_update(Map *map, ConstStr key, const VoidPtr new_data) {
+    return container_map_update_hashed(map, hash_str(key, CONTAINER_MAP_HASH_MODE), key, new_data);
+}
+
+ContainerResult container_map_update_hashed(Map *map, const HashedInt hashed_key, ConstStr key, const VoidPtr new_data) {
     if (!map || !key) return CONTAINER_ERROR_INVALID_PARAM;
     if (!(*map)->_memory_size) return CONTAINER_ERROR_NOT_ALLOCATED;
 
-    HashedInt    hashed_       = hash_str(key, HASH_MODE_XX64);
-    ByteSize     idx_          = hashed_ % (*map)->_capacity;
-    ByteSize     check_offset_ = (sizeof(MapDataItem) + (*map)->_data_size) * idx_;
-    MapDataItem *check_slot_   = (MapDataItem *)((BytePtr)((*map)->_pool) + check_offset_);
-
-    ByteSize probe_        = 1;
-    ByteSize probe_length_ = 0;
-    while (check_slot_->_hashed_key != 0) {
-        if (check_slot_->_hashed_key == hashed_) {
-            // found matching slot
-            memmove((VoidPtr)check_slot_->_pdata, new_data, (*map)->_data_size);
-            return CONTAINER_SUCCESS;
-        }
-
-        if (++probe_length_ > MAX_PROBE_LENGTH((*map)->_capacity))
-            return CONTAINER_ERROR_MAP_REACHED_PROBING_LIMITS;  // failed due to excessive probing
-
-        // continue probing
-        {
-            UInt64 hash2_ = check_slot_->_hashed_key;
-            idx_          = (idx_ + (probe_ * hash2_)) % (*map)->_capacity;
-
-            check_offset_ = (sizeof(MapDataItem) + (*map)->_data_size) * idx_;
-            check_slot_   = (MapDataItem *)((BytePtr)((*map)->_pool) + check_offset_);
-        }
-
-        ++probe_;
-    }
+    MapEntry *entry_ = _container_map_find(*map, _container_map_mix(hashed_key), key, strlen(key), NULL);
+    if (!entry_) return CONTAINER_ERROR_MAP_KEY_NOT_FOUND;
 
-    return CONTAINER_ERROR_MAP_KEY_NOT_FOUND;
+    memmove(_container_map_slot_data(*map, entry_), new_data, (*map)->_data_size);
+    return CONTAINER_SUCCESS;
 }
 
 ContainerResult container_map_search(Map map, ConstStr key, VoidPtr *out_data) {
+    return container_map_search_hashed(map, hash_str(key, CONTAINER_MAP_HASH_MODE), key, out_data);
+}
+
+// a missing key is not an error: out_data is left untouched
+ContainerResult container_map_search_hashed(Map map, const HashedInt hashed_key, ConstStr key, VoidPtr *out_data) {
     if (!map || !key || !out_data) return CONTAINER_ERROR_INVALID_PARAM;
     if (!map->_memory_size) return CONTAINER_ERROR_NOT_ALLOCATED;
 
-    HashedInt    hashed_       = hash_str(key, HASH_MODE_XX64);
-    ByteSize     idx_          = hashed_ % map->_capacity;
-    ByteSize     check_offset_ = (sizeof(MapDataItem) + map->_data_size) * idx_;
-    MapDataItem *check_slot_   = (MapDataItem *)((BytePtr)(map->_pool) + check_offset_);
-
-    ByteSize probe_        = 1;
-    ByteSize probe_length_ = 0;
-    while (check_slot_->_hashed_key != 0) {
-        // found matching slot
-        if ((check_slot_->_hashed_key != TOMBSTONE_HASHED_KEY) &&
-            (check_slot_->_hashed_key == hashed_) &&
-            (!strcmp(container_string_get(check_slot_->_key), key))) {
-            memcpy(out_data, (VoidPtr)check_slot_->_pdata, map->_data_size);
-            return CONTAINER_SUCCESS;
-        }
-
-        // otherwise
-        else {
-            if (++probe_length_ > MAX_PROBE_LENGTH(map->_capacity))
-                return CONTAINER_ERROR_MAP_REACHED_PROBING_LIMITS;  // failed due to excessive probing
-
-            // continue probing
-            {
-                UInt64 hash2_ = check_slot_->_hashed_key;
-                idx_          = (idx_ + (probe_ * hash2_)) % map->_capacity;
-
-                check_offset_ = (sizeof(MapDataItem) + map->_data_size) * idx_;
-                check_slot_   = (MapDataItem *)((BytePtr)(map->_pool) + check_offset_);
-            }
+    MapEntry *entry_ = _container_map_find(map, _container_map_mix(hashed_key), key, strlen(key), NULL);
 
-            ++probe_;
-        }
-    }
+    if (entry_)
+        memcpy(out_data, _container_map_slot_data(map, entry_), map->_data_size);
 
     return CONTAINER_SUCCESS;
 }
 
 Bool container_map_contains(Map map, ConstStr key) {
+    return container_map_contains_hashed(map, hash_str(key, CONTAINER_MAP_HASH_MODE), key);
+}
+
+Bool container_map_contains_hashed(Map map, const HashedInt hashed_key, ConstStr key) {
     if (!map || !key) return false;
     if (!map->_memory_size) return false;
 
-    VoidPtr data_ = NULL;
-    if (container_map_search(map, key, &data_) != CONTAINER_SUCCESS) return false;
+    return (_container_map_find(map, _container_map_mix(hashed_key), key, strlen(key), NULL) != NULL);
+}
+
+Bool container_map_iter_begin(Map map, MapIterator *out_iter) {
+    if (!out_iter) return false;
+
+    out_iter->_index = (ByteSize)-1;
+    return container_map_iter_next(map, out_iter);
+}
+
+Bool container_map_iter_next(Map map, MapIterator *iter) {
+    if (!map || !iter) return false;
+    if (!map->_memory_size) return false;
+
+    iter->_index = _container_map_next_occupied(map, iter->_index + 1);
+    if (iter->_index >= map->_capacity) return false;
+
+    MapEntry *entry_ = _container_map_slot(map, iter->_index);
+    iter->_key       = _container_map_entry_key(entry_);
+    iter->_data      = _container_map_slot_data(map, entry_);
 
-    return (data_ != NULL);
+    return true;
+}
+
+ContainerResult container_map_reserve(Map *map, const ByteSize count) {
+    if (!map) return CONTAINER_ERROR_INVALID_PARAM;
+    if (!(*map)->_memory_size) return CONTAINER_ERROR_NOT_ALLOCATED;
+
+    return _container_map_reserve(map, count);
+}
+
+ContainerResult container_map_shrink_to_fit(Map *map) {
+    if (!map) return CONTAINER_ERROR_INVALID_PARAM;
+    if (!(*map)->_memory_size) return CONTAINER_ERROR_NOT_ALLOCATED;
+
+    return _container_map_shrink_to_fit(map);
 }
 
 Bool container_map_empty(Map map) {
@@ -362,11 +672,907 @@ ByteSize container_map_data_size(Map map) {
 
 VoidPtr container_map_at_index(Map map, const ByteSize index) {
     if (!map) return NULL;
-    if (!map->_memory_size || !map->_pool) return NULL;
-    if ((index < 0) || (index > map->_capacity)) return NULL;
+    if (!map->_memory_size) return NULL;
+    if (index >= map->_capacity) return NULL;
+
+    return _container_map_slot_data(map, _container_map_slot(map, index));
+}
+
+// ---------------------------------------------------------------------- //
+
+ContainerResult container_id_map_construct(const ByteSize data_size, IdMap *out_new_map) {
+    if (!data_size || !out_new_map) return CONTAINER_ERROR_INVALID_PARAM;
+
+    Map             table_    = NULL;
+    ContainerResult allocate_ = _container_map_allocate(sizeof(MapIdEntry), data_size, _container_map_default_capacity(), &table_);
+    if (allocate_ != CONTAINER_SUCCESS)
+        return allocate_;
+
+    *out_new_map = (IdMap)table_;
+    return CONTAINER_SUCCESS;
+}
+
+ContainerResult container_id_map_destruct(IdMap map) {
+    if (!map) return CONTAINER_ERROR_INVALID_PARAM;
+    if (!map->_table._memory_size) return CONTAINER_ERROR_NOT_ALLOCATED;
+
+    if (memory_zone_deallocate(MEMORY_ZONE_CONTAINERS, map, map->_table._memory_size) != MEMORY_ZONE_SUCCESS)
+        return CONTAINER_ERROR_DEALLOCATION_FAILED;
+
+    return CONTAINER_SUCCESS;
+}
+
+ContainerResult container_id_map_insert(IdMap *map, const UInt64 key, const VoidPtr data) {
+    if (!map || !data) return CONTAINER_ERROR_INVALID_PARAM;
+    if (!(*map)->_table._memory_size) return CONTAINER_ERROR_NOT_ALLOCATED;
+
+    Map       table_  = &(*map)->_table;
+    HashedInt hashed_ = _container_map_mix(key);
+    ByteSize  index_  = 0;
+
+    if (_container_map_find_id(table_, hashed_, key, &index_))
+        return CONTAINER_ERROR_MAP_KEY_ALREADY_EXISTS;
+
+    Bool            resized_ = false;
+    ContainerResult reserve_ = _container_map_reserve_slot(&table_, &resized_);
+    if (reserve_ != CONTAINER_SUCCESS)
+        return reserve_;
+
+    if (resized_) {
+        *map = (IdMap)table_;
+        _container_map_find_id(table_, hashed_, key, &index_);
+    }
+
+    MapIdEntry *entry_  = _container_map_slot(table_, index_);
+    entry_->_hashed_key = hashed_;
+    entry_->_key        = key;
+    memcpy(_container_map_slot_data(table_, entry_), data, table_->_data_size);
 
-    ByteSize     check_offset_ = (sizeof(MapDataItem) + map->_data_size) * index;
-    MapDataItem *check_slot_   = (MapDataItem *)((BytePtr)(map->_pool) + check_offset_);
+    _container_map_set_ctrl(table_, index_, MAP_CTRL_TAG(hashed_));
+    ++table_->_size;
+
+    return CONTAINER_SUCCESS;
+}
+
+ContainerResult container_id_map_insert_many(IdMap *map, const UInt64 *keys, const VoidPtr data, const ByteSize count) {
+    if (!map || !keys || !data) return CONTAINER_ERROR_INVALID_PARAM;
+
+    ContainerResult reserve_ = container_id_map_reserve(map, container_id_map_size(*map) + count);
+    if (reserve_ != CONTAINER_SUCCESS)
+        return reserve_;
+
+    for (ByteSize i = 0; i < count; ++i) {
+        ContainerResult insert_ = container_id_map_insert(map, keys[i], (VoidPtr)((BytePtr)data + (i * (*map)->_table._data_size)));
+        if (insert_ != CONTAINER_SUCCESS)
+            return insert_;
+    }
+
+    return CONTAINER_SUCCESS;
+}
+
+ContainerResult container_id_map_remove(IdMap *map, const UInt64 key) {
+    if (!map) return CONTAINER_ERROR_INVALID_PARAM;
+    if (!(*map)->_table._memory_size) return CONTAINER_ERROR_NOT_ALLOCATED;
+
+    MapIdEntry *entry_ = _container_map_find_id(&(*map)->_table, _container_map_mix(key), key, NULL);
+    if (!entry_) return CONTAINER_ERROR_MAP_KEY_NOT_FOUND;
+
+    _container_map_erase(&(*map)->_table, entry_);
+    return CONTAINER_SUCCESS;
+}
+
+ContainerResult container_id_map_update(IdMap *map, const UInt64 key, const VoidPtr new_data) {
+    if (!map || !new_data) return CONTAINER_ERROR_INVALID_PARAM;
+    if (!(*map)->_table._memory_size) return CONTAINER_ERROR_NOT_ALLOCATED;
+
+    MapIdEntry *entry_ = _container_map_find_id(&(*map)->_table, _container_map_mix(key), key, NULL);
+    if (!entry_) return CONTAINER_ERROR_MAP_KEY_NOT_FOUND;
+
+    memmove(_container_map_slot_data(&(*map)->_table, entry_), new_data, (*map)->_table._data_size);
+    return CONTAINER_SUCCESS;
+}
+
+ContainerResult container_id_map_search(IdMap map, const UInt64 key, VoidPtr *out_data) {
+    if (!map || !out_data) return CONTAINER_ERROR_INVALID_PARAM;
+    if (!map->_table._memory_size) return CONTAINER_ERROR_NOT_ALLOCATED;
+
+    MapIdEntry *entry_ = _container_map_find_id(&map->_table, _container_map_mix(key), key, NULL);
+    if (!entry_) return CONTAINER_ERROR_MAP_KEY_NOT_FOUND;
+
+    memcpy(out_data, _container_map_slot_data(&map->_table, entry_), map->_table._data_size);
+    return CONTAINER_SUCCESS;
+}
+
+Bool container_id_map_contains(IdMap map, const UInt64 key) {
+    if (!map) return false;
+    if (!map->_table._memory_size) return false;
+
+    return (_container_map_find_id(&map->_table, _container_map_mix(key), key, NULL) != NULL);
+}
+
+Bool container_id_map_iter_begin(IdMap map, IdMapIterator *out_iter) {
+    if (!out_iter) return false;
+
+    out_iter->_index = (ByteSize)-1;
+    return container_id_map_iter_next(map, out_iter);
+}
 
-    return (VoidPtr)((BytePtr)check_slot_ + sizeof(MapDataItem));
+Bool container_id_map_iter_next(IdMap map, IdMapIterator *iter) {
+    if (!map || !iter) return false;
+    if (!map->_table._memory_size) return false;
+
+    iter->_index = _container_map_next_occupied(&map->_table, iter->_index + 1);
+    if (iter->_index >= map->_table._capacity) return false;
+
+    MapIdEntry *entry_ = _container_map_slot(&map->_table, iter->_index);
+    iter->_key         = entry_->_key;
+    iter->_data        = _container_map_slot_data(&map->_table, entry_);
+
+    return true;
+}
+
+ContainerResult container_id_map_reserve(IdMap *map, const ByteSize count) {
+    if (!map) return CONTAINER_ERROR_INVALID_PARAM;
+    if (!(*map)->_table._memory_size) return CONTAINER_ERROR_NOT_ALLOCATED;
+
+    Map             table_   = &(*map)->_table;
+    ContainerResult reserve_ = _container_map_reserve(&table_, count);
+
+    *map = (IdMap)table_;
+    return reserve_;
+}
+
+ContainerResult container_id_map_shrink_to_fit(IdMap *map) {
+    if (!map) return CONTAINER_ERROR_INVALID_PARAM;
+    if (!(*map)->_table._memory_size) return CONTAINER_ERROR_NOT_ALLOCATED;
+
+    Map             table_  = &(*map)->_table;
+    ContainerResult shrink_ = _container_map_shrink_to_fit(&table_);
+
+    *map = (IdMap)table_;
+    return shrink_;
+}
+
+Bool container_id_map_empty(IdMap map) {
+    return (!map ? true : !map->_table._size);
+}
+
+ByteSize container_id_map_size(IdMap map) {
+    return (!map ? 0 : map->_table._size);
+}
+
+ByteSize container_id_map_capacity(IdMap map) {
+    return (!map ? 0 : map->_table._capacity);
+}
+
+ByteSize container_id_map_data_size(IdMap map) {
+    return (!map ? 0 : map->_table._data_size);
+}
+
+// ---------------------------------------------------------------------- //
+
+VYTAL_INLINE MapEntry *_container_ordered_map_entry(OrderedMap map, const ByteSize position) {
+    return (MapEntry *)((BytePtr)map->_entries + (position * map->_entry_size));
+}
+
+MapIndexEntry *_container_ordered_map_find(OrderedMap map, const HashedInt hashed_key, ConstStr key, const ByteSize key_length, ByteSize *out_empty_index) {
+    Map      index_ = map->_index;
+    ByteSize mask_  = index_->_capacity - 1;
+    ByteSize pos_   = hashed_key & mask_;
+    UInt8    tag_   = MAP_CTRL_TAG(hashed_key);
+
+    for (;;) {
+        UInt32 empty_ = 0;
+        UInt32 match_ = _container_map_group_match(index_->_ctrl + pos_, tag_, &empty_);
+        match_        = _container_map_chain_matches(match_, empty_);
+
+        // the slot holds the full hash, so the entry (and its key) is only touched on a likely hit
+        while (match_) {
+            MapIndexEntry *slot_ = _container_map_slot(index_, (pos_ + _container_map_ctz(match_)) & mask_);
+
+            if (slot_->_hashed_key == hashed_key) {
+                MapEntry *entry_ = _container_ordered_map_entry(map, slot_->_position);
+
+                if ((entry_->_key_length == key_length) && _container_map_key_equals(_container_map_entry_key(entry_), key, key_length))
+                    return slot_;
+            }
+
+            match_ &= match_ - 1;
+        }
+
+        if (empty_) {
+            if (out_empty_index) *out_empty_index = (pos_ + _container_map_ctz(empty_)) & mask_;
+            return NULL;
+        }
+
+        pos_ = (pos_ + MAP_GROUP_WIDTH) & mask_;
+    }
+}
+
+VYTAL_INLINE void _container_ordered_map_link(OrderedMap map, const ByteSize index, const ByteSize position) {
+    MapEntry      *entry_ = _container_ordered_map_entry(map, position);
+    MapIndexEntry *slot_  = _container_map_slot(map->_index, index);
+
+    slot_->_hashed_key = entry_->_hashed_key;
+    slot_->_position   = position;
+
+    _container_map_set_ctrl(map->_index, index, MAP_CTRL_TAG(entry_->_hashed_key));
+    ++map->_index->_size;
+}
+
+ContainerResult _container_ordered_map_resize_entries(OrderedMap map, const ByteSize new_capacity) {
+    ByteSize alloc_size_ = map->_entry_size * new_capacity;
+    VoidPtr  entries_    = NULL;
+
+    if (memory_zone_allocate(MEMORY_ZONE_CONTAINERS, alloc_size_, &entries_, &alloc_size_) != MEMORY_ZONE_SUCCESS)
+        return CONTAINER_ERROR_ALLOCATION_FAILED;
+
+    if (map->_entries) {
+        memcpy(entries_, map->_entries, map->_count * map->_entry_size);
+
+        if (memory_zone_deallocate(MEMORY_ZONE_CONTAINERS, map->_entries, map->_entries_memory_size) != MEMORY_ZONE_SUCCESS)
+            return CONTAINER_ERROR_DEALLOCATION_FAILED;
+    }
+
+    map->_entries             = entries_;
+    map->_entries_memory_size = alloc_size_;
+    map->_capacity            = new_capacity;
+
+    return CONTAINER_SUCCESS;
+}
+
+// squeezes the holes out of the entries and rebuilds the table from the stored hashes
+void _container_ordered_map_compact(OrderedMap map) {
+    memset(map->_index->_ctrl, MAP_CTRL_EMPTY, map->_index->_capacity + MAP_GROUP_WIDTH);
+    map->_index->_size = 0;
+
+    ByteSize live_ = 0;
+    for (ByteSize i = 0; i < map->_count; ++i) {
+        MapEntry *entry_ = _container_ordered_map_entry(map, i);
+        if (entry_->_key_length == MAP_REMOVED_KEY_LENGTH) continue;
+
+        if (live_ != i) memcpy(_container_ordered_map_entry(map, live_), entry_, map->_entry_size);
+
+        _container_ordered_map_link(map, _container_map_find_empty(map->_index, entry_->_hashed_key), live_);
+        ++live_;
+    }
+
+    map->_count = live_;
+}
+
+ContainerResult container_ordered_map_construct(const ByteSize data_size, OrderedMap *out_new_map) {
+    if (!data_size || !out_new_map) return CONTAINER_ERROR_INVALID_PARAM;
+
+    OrderedMap map_        = NULL;
+    ByteSize   alloc_size_ = 0;
+    if (memory_zone_allocate_zeroed(MEMORY_ZONE_CONTAINERS, sizeof(struct Container_Ordered_Map), (VoidPtr *)&map_, &alloc_size_) != MEMORY_ZONE_SUCCESS)
+        return CONTAINER_ERROR_ALLOCATION_FAILED;
+
+    map_->_entry_size  = sizeof(MapEntry) + VYTAL_APPLY_ALIGNMENT(data_size, sizeof(VoidPtr));
+    map_->_data_size   = data_size;
+    map_->_memory_size = alloc_size_;
+
+    if (_container_map_allocate(sizeof(MapIndexEntry), 0, _container_map_default_capacity(), &map_->_index) != CONTAINER_SUCCESS ||
+        _container_ordered_map_resize_entries(map_, CONTAINER_DEFAULT_CAPACITY) != CONTAINER_SUCCESS) {
+        container_ordered_map_destruct(map_);
+        return CONTAINER_ERROR_ALLOCATION_FAILED;
+    }
+
+    *out_new_map = map_;
+    return CONTAINER_SUCCESS;
+}
+
+ContainerResult container_ordered_map_destruct(OrderedMap map) {
+    if (!map) return CONTAINER_ERROR_INVALID_PARAM;
+    if (!map->_memory_size) return CONTAINER_ERROR_NOT_ALLOCATED;
+
+    for (ByteSize i = 0; i < map->_count; ++i) {
+        MapEntry *entry_ = _container_ordered_map_entry(map, i);
+
+        if ((entry_->_key_length != MAP_REMOVED_KEY_LENGTH) && (entry_->_key_length >= MAP_INLINE_KEY_SIZE)) {
+            if (container_string_destruct(entry_->_key._string) != CONTAINER_SUCCESS)
+                return CONTAINER_ERROR_DEALLOCATION_FAILED;
+        }
+    }
+
+    if (map->_entries && (memory_zone_deallocate(MEMORY_ZONE_CONTAINERS, map->_entries, map->_entries_memory_size) != MEMORY_ZONE_SUCCESS))
+        return CONTAINER_ERROR_DEALLOCATION_FAILED;
+
+    // the table holds no keys of its own
+    if (map->_index && (memory_zone_deallocate(MEMORY_ZONE_CONTAINERS, map->_index, map->_index->_memory_size) != MEMORY_ZONE_SUCCESS))
+        return CONTAINER_ERROR_DEALLOCATION_FAILED;
+
+    if (memory_zone_deallocate(MEMORY_ZONE_CONTAINERS, map, map->_memory_size) != MEMORY_ZONE_SUCCESS)
+        return CONTAINER_ERROR_DEALLOCATION_FAILED;
+
+    return CONTAINER_SUCCESS;
+}
+
+ContainerResult container_ordered_map_insert(OrderedMap *map, ConstStr key, const VoidPtr data) {
+    return container_ordered_map_insert_hashed(map, hash_str(key, CONTAINER_MAP_HASH_MODE), key, data);
+}
+
+ContainerResult container_ordered_map_insert_hashed(OrderedMap *map, const HashedInt hashed_key, ConstStr key, const VoidPtr data) {
+    if (!map || !key || !data) return CONTAINER_ERROR_INVALID_PARAM;
+    if (!(*map)->_memory_size) return CONTAINER_ERROR_NOT_ALLOCATED;
+
+    OrderedMap map_        = *map;
+    ByteSize   key_length_ = strlen(key);
+    HashedInt  hashed_     = _container_map_mix(hashed_key);
+    ByteSize   index_      = 0;
+
+    if (_container_ordered_map_find(map_, hashed_, key, key_length_, &index_))
+        return CONTAINER_ERROR_MAP_KEY_ALREADY_EXISTS;
+
+    // make room at the end of the entries: drop the holes once they are half of them, grow otherwise
+    Bool moved_ = false;
+    if (map_->_count == map_->_capacity) {
+        if ((map_->_count - map_->_size) * 2 >= map_->_count)
+            _container_ordered_map_compact(map_);
+
+        else {
+            ContainerResult resize_ = _container_ordered_map_resize_entries(map_, map_->_capacity * CONTAINER_RESIZE_FACTOR);
+            if (resize_ != CONTAINER_SUCCESS)
+                return resize_;
+        }
+
+        moved_ = true;
+    }
+
+    Bool            resized_ = false;
+    ContainerResult reserve_ = _container_map_reserve_slot(&map_->_index, &resized_);
+    if (reserve_ != CONTAINER_SUCCESS)
+        return reserve_;
+
+    if (moved_ || resized_)
+        index_ = _container_map_find_empty(map_->_index, hashed_);
+
+    MapEntry *entry_ = _container_ordered_map_entry(map_, map_->_count);
+
+    if (key_length_ < MAP_INLINE_KEY_SIZE)
+        memcpy(entry_->_key._inline, key, key_length_ + 1);
+    else if (container_string_construct(key, &entry_->_key._string) != CONTAINER_SUCCESS)
+        return CONTAINER_ERROR_ALLOCATION_FAILED;
+
+    entry_->_hashed_key = hashed_;
+    entry_->_key_length = key_length_;
+    memcpy((BytePtr)entry_ + sizeof(MapEntry), data, map_->_data_size);
+
+    _container_ordered_map_link(map_, index_, map_->_count++);
+    ++map_->_size;
+
+    return CONTAINER_SUCCESS;
+}
+
+ContainerResult container_ordered_map_remove(OrderedMap *map, ConstStr key) {
+    return container_ordered_map_remove_hashed(map, hash_str(key, CONTAINER_MAP_HASH_MODE), key);
+}
+
+ContainerResult container_ordered_map_remove_hashed(OrderedMap *map, const HashedInt hashed_key, ConstStr key) {
+    if (!map || !key) return CONTAINER_ERROR_INVALID_PARAM;
+    if (!(*map)->_memory_size) return CONTAINER_ERROR_NOT_ALLOCATED;
+
+    OrderedMap     map_  = *map;
+    MapIndexEntry *slot_ = _container_ordered_map_find(map_, _container_map_mix(hashed_key), key, strlen(key), NULL);
+    if (!slot_) return CONTAINER_ERROR_MAP_KEY_NOT_FOUND;
+
+    MapEntry *entry_ = _container_ordered_map_entry(map_, slot_->_position);
+    if ((entry_->_key_length >= MAP_INLINE_KEY_SIZE) && (container_string_destruct(entry_->_key._string) != CONTAINER_SUCCESS))
+        return CONTAINER_ERROR_DEALLOCATION_FAILED;
+
+    entry_->_key_length = MAP_REMOVED_KEY_LENGTH;
+    _container_map_erase(map_->_index, slot_);
+    --map_->_size;
+
+    // holes at the end are simply given back
+    while (map_->_count && (_container_ordered_map_entry(map_, map_->_count - 1)->_key_length == MAP_REMOVED_KEY_LENGTH))
+        --map_->_count;
+
+    return CONTAINER_SUCCESS;
+}
+
+ContainerResult container_ordered_map_update(OrderedMap *map, ConstStr key, const VoidPtr new_data) {
+    return container_ordered_map_update_hashed(map, hash_str(key, CONTAINER_MAP_HASH_MODE), key, new_data);
+}
+
+ContainerResult container_ordered_map_update_hashed(OrderedMap *map, const HashedInt hashed_key, ConstStr key, const VoidPtr new_data) {
+    if (!map || !key || !new_data) return CONTAINER_ERROR_INVALID_PARAM;
+    if (!(*map)->_memory_size) return CONTAINER_ERROR_NOT_ALLOCATED;
+
+    MapIndexEntry *slot_ = _container_ordered_map_find(*map, _container_map_mix(hashed_key), key, strlen(key), NULL);
+    if (!slot_) return CONTAINER_ERROR_MAP_KEY_NOT_FOUND;
+
+    memmove((BytePtr)_container_ordered_map_entry(*map, slot_->_position) + sizeof(MapEntry), new_data, (*map)->_data_size);
+    return CONTAINER_SUCCESS;
+}
+
+ContainerResult container_ordered_map_search(OrderedMap map, ConstStr key, VoidPtr *out_data) {
+    return container_ordered_map_search_hashed(map, hash_str(key, CONTAINER_MAP_HASH_MODE), key, out_data);
+}
+
+ContainerResult container_ordered_map_search_hashed(OrderedMap map, const HashedInt hashed_key, ConstStr key, VoidPtr *out_data) {
+    if (!map || !key || !out_data) return CONTAINER_ERROR_INVALID_PARAM;
+    if (!map->_memory_size) return CONTAINER_ERROR_NOT_ALLOCATED;
+
+    MapIndexEntry *slot_ = _container_ordered_map_find(map, _container_map_mix(hashed_key), key, strlen(key), NULL);
+    if (!slot_) return CONTAINER_ERROR_MAP_KEY_NOT_FOUND;
+
+    memcpy(out_data, (BytePtr)_container_ordered_map_entry(map, slot_->_position) + sizeof(MapEntry), map->_data_size);
+    return CONTAINER_SUCCESS;
+}
+
+Bool container_ordered_map_contains(OrderedMap map, ConstStr key) {
+    return container_ordered_map_contains_hashed(map, hash_str(key, CONTAINER_MAP_HASH_MODE), key);
+}
+
+Bool container_ordered_map_contains_hashed(OrderedMap map, const HashedInt hashed_key, ConstStr key) {
+    if (!map || !key) return false;
+    if (!map->_memory_size) return false;
+
+    return (_container_ordered_map_find(map, _container_map_mix(hashed_key), key, strlen(key), NULL) != NULL);
+}
+
+ContainerResult container_ordered_map_reserve(OrderedMap *map, const ByteSize count) {
+    if (!map) return CONTAINER_ERROR_INVALID_PARAM;
+    if (!(*map)->_memory_size) return CONTAINER_ERROR_NOT_ALLOCATED;
+
+    ContainerResult reserve_ = _container_map_reserve(&(*map)->_index, count);
+    if (reserve_ != CONTAINER_SUCCESS)
+        return reserve_;
+
+    // the holes don't count towards it, they go on the next compaction
+    ByteSize capacity_ = (*map)->_count - (*map)->_size + count;
+    return (capacity_ > (*map)->_capacity) ? _container_ordered_map_resize_entries(*map, capacity_) : CONTAINER_SUCCESS;
+}
+
+// entries come in insertion order; _index is their position
+Bool container_ordered_map_iter_begin(OrderedMap map, MapIterator *out_iter) {
+    if (!out_iter) return false;
+
+    out_iter->_index = (ByteSize)-1;
+    return container_ordered_map_iter_next(map, out_iter);
+}
+
+Bool container_ordered_map_iter_next(OrderedMap map, MapIterator *iter) {
+    if (!map || !iter) return false;
+    if (!map->_memory_size) return false;
+
+    for (++iter->_index; iter->_index < map->_count; ++iter->_index) {
+        MapEntry *entry_ = _container_ordered_map_entry(map, iter->_index);
+        if (entry_->_key_length == MAP_REMOVED_KEY_LENGTH) continue;
+
+        iter->_key  = _container_map_entry_key(entry_);
+        iter->_data = (BytePtr)entry_ + sizeof(MapEntry);
+        return true;
+    }
+
+    return false;
+}
+
+Bool container_ordered_map_empty(OrderedMap map) {
+    return (!map ? true : !map->_size);
+}
+
+ByteSize container_ordered_map_size(OrderedMap map) {
+    return (!map ? 0 : map->_size);
+}
+
+ByteSize container_ordered_map_capacity(OrderedMap map) {
+    return (!map ? 0 : map->_capacity);
+}
+
+ByteSize container_ordered_map_data_size(OrderedMap map) {
+    return (!map ? 0 : map->_data_size);
+}
+
+// ---------------------------------------------------------------------- //
+
+VYTAL_INLINE ConcurrentMapShard *_container_concurrent_map_shard(ConcurrentMap map, const HashedInt hashed_key) {
+    // the home slot comes from the low bits and the tag from the top ones, so the shard takes the middle
+    return &map->_shards[(hashed_key >> 32) & (CONTAINER_CONCURRENT_MAP_SHARDS - 1)];
+}
+
+VYTAL_INLINE void _container_concurrent_map_lock(volatile Int32 *lock) {
+    while (__atomic_exchange_n(lock, 1, __ATOMIC_ACQUIRE)) {
+        while (__atomic_load_n(lock, __ATOMIC_RELAXED)) {
+#if defined(__SSE2__)
+            _mm_pause();
+#endif
+        }
+    }
+}
+
+VYTAL_INLINE void _container_concurrent_map_unlock(volatile Int32 *lock) {
+    __atomic_store_n(lock, 0, __ATOMIC_RELEASE);
+}
+
+// publishes the epoch the reader is in, so nothing it picks up from here on is freed under it;
+// NULL once the thread is past the last reader slot
+static ConcurrentMapReader *_container_concurrent_map_read_begin(ConcurrentMap map) {
+    if (map_reader_slot < 0)
+        map_reader_slot = __atomic_fetch_add(&map_reader_count, 1, __ATOMIC_RELAXED);
+
+    if (map_reader_slot >= CONTAINER_CONCURRENT_MAP_READERS) return NULL;
+
+    ConcurrentMapReader *reader_ = &map->_readers[map_reader_slot];
+    __atomic_store_n(&reader_->_epoch, __atomic_load_n(&map->_epoch, __ATOMIC_ACQUIRE), __ATOMIC_SEQ_CST);
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+
+    return reader_;
+}
+
+VYTAL_INLINE void _container_concurrent_map_read_end(ConcurrentMapReader *reader) {
+    if (reader) __atomic_store_n(&reader->_epoch, 0, __ATOMIC_RELEASE);
+}
+
+VYTAL_INLINE void _container_concurrent_map_write_begin(ConcurrentMapShard *shard) {
+    _container_concurrent_map_lock(&shard->_lock);
+
+    __atomic_store_n(&shard->_sequence, shard->_sequence + 1, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+}
+
+// memory is retired in the epoch it was unlinked in; the epoch moves on, so readers entering later never see it
+ContainerResult _container_concurrent_map_retire(ConcurrentMap map, ConcurrentMapShard *shard, VoidPtr ptr, const Bool is_table) {
+    ConcurrentMapRetired *retired_ = NULL;
+    if (memory_zone_allocate(MEMORY_ZONE_CONTAINERS, sizeof(ConcurrentMapRetired), (VoidPtr *)&retired_, NULL) != MEMORY_ZONE_SUCCESS)
+        return CONTAINER_ERROR_ALLOCATION_FAILED;
+
+    retired_->_ptr      = ptr;
+    retired_->_is_table = is_table;
+    retired_->_epoch    = __atomic_fetch_add(&map->_epoch, 1, __ATOMIC_SEQ_CST);
+    retired_->_next     = shard->_retired;
+
+    shard->_retired = retired_;
+    return CONTAINER_SUCCESS;
+}
+
+// frees whatever every reader inside the map has moved past (the shard's lock is held)
+ContainerResult _container_concurrent_map_reclaim(ConcurrentMap map, ConcurrentMapShard *shard) {
+    if (!shard->_retired) return CONTAINER_SUCCESS;
+
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+
+    UInt64 oldest_ = (UInt64)-1;
+    for (ByteSize i = 0; i < CONTAINER_CONCURRENT_MAP_READERS; ++i) {
+        UInt64 epoch_ = __atomic_load_n(&map->_readers[i]._epoch, __ATOMIC_ACQUIRE);
+        if (epoch_ && (epoch_ < oldest_)) oldest_ = epoch_;
+    }
+
+    ConcurrentMapRetired **link_ = (ConcurrentMapRetired **)&shard->_retired;
+    while (*link_) {
+        ConcurrentMapRetired *retired_ = *link_;
+
+        if (retired_->_epoch >= oldest_) {
+            link_ = &retired_->_next;
+            continue;
+        }
+
+        *link_ = retired_->_next;
+
+        if (retired_->_is_table) {
+            Map table_ = retired_->_ptr;
+            if (memory_zone_deallocate(MEMORY_ZONE_CONTAINERS, table_, table_->_memory_size) != MEMORY_ZONE_SUCCESS)
+                return CONTAINER_ERROR_DEALLOCATION_FAILED;
+
+        } else if (container_string_destruct(retired_->_ptr) != CONTAINER_SUCCESS)
+            return CONTAINER_ERROR_DEALLOCATION_FAILED;
+
+        if (memory_zone_deallocate(MEMORY_ZONE_CONTAINERS, retired_, sizeof(ConcurrentMapRetired)) != MEMORY_ZONE_SUCCESS)
+            return CONTAINER_ERROR_DEALLOCATION_FAILED;
+    }
+
+    return CONTAINER_SUCCESS;
+}
+
+VYTAL_INLINE ContainerResult _container_concurrent_map_write_end(ConcurrentMap map, ConcurrentMapShard *shard) {
+    __atomic_store_n(&shard->_sequence, shard->_sequence + 1, __ATOMIC_RELEASE);
+
+    ContainerResult reclaim_ = _container_concurrent_map_reclaim(map, shard);
+    _container_concurrent_map_unlock(&shard->_lock);
+
+    return reclaim_;
+}
+
+VYTAL_INLINE Bool _container_concurrent_map_validate(ConcurrentMapShard *shard, const UInt64 sequence) {
+    __atomic_thread_fence(__ATOMIC_ACQUIRE);
+    return (__atomic_load_n(&shard->_sequence, __ATOMIC_RELAXED) == sequence);
+}
+
+// one lock-free pass over the shard's table; false if a writer got in the way and the pass has to be redone
+Bool _container_concurrent_map_try_search(ConcurrentMapShard *shard, const HashedInt hashed_key, ConstStr key, const ByteSize key_length, VoidPtr out_data, Bool *out_found) {
+    UInt64 sequence_ = __atomic_load_n(&shard->_sequence, __ATOMIC_ACQUIRE);
+    if (sequence_ & 1) return false;
+
+    Map       table_ = __atomic_load_n(&shard->_table, __ATOMIC_ACQUIRE);
+    ByteSize  mask_  = table_->_capacity - 1;
+    ByteSize  pos_   = hashed_key & mask_;
+    UInt8     tag_   = MAP_CTRL_TAG(hashed_key);
+    MapEntry *found_ = NULL;
+
+    // a table caught mid-change may have lost its empty slots, so the walk is bounded as well
+    for (ByteSize probed_ = 0; !found_ && (probed_ <= table_->_capacity); probed_ += MAP_GROUP_WIDTH) {
+        UInt32 empty_ = 0;
+        UInt32 match_ = _container_map_group_match(table_->_ctrl + pos_, tag_, &empty_);
+        match_        = _container_map_chain_matches(match_, empty_);
+
+        for (; match_ && !found_; match_ &= match_ - 1) {
+            MapEntry *entry_ = _container_map_slot(table_, (pos_ + _container_map_ctz(match_)) & mask_);
+            if ((entry_->_hashed_key != hashed_key) || (entry_->_key_length != key_length)) continue;
+
+            ConstStr stored_ = entry_->_key._inline;
+
+            // a string pointer read off a slot that was rewritten meanwhile may be anything
+            if (key_length >= MAP_INLINE_KEY_SIZE) {
+                String string_ = entry_->_key._string;
+                if (!_container_concurrent_map_validate(shard, sequence_)) return false;
+
+                stored_ = container_string_get(string_);
+            }
+
+            if (_container_map_key_equals(stored_, key, key_length)) found_ = entry_;
+        }
+
+        if (empty_) break;
+        pos_ = (pos_ + MAP_GROUP_WIDTH) & mask_;
+    }
+
+    if (found_ && out_data)
+        memcpy(out_data, _container_map_slot_data(table_, found_), table_->_data_size);
+
+    *out_found = (found_ != NULL);
+    return _container_concurrent_map_validate(shard, sequence_);
+}
+
+Bool _container_concurrent_map_search(ConcurrentMap map, const HashedInt hashed_key, ConstStr key, VoidPtr out_data) {
+    ByteSize             key_length_ = strlen(key);
+    HashedInt            hashed_     = _container_map_mix(hashed_key);
+    ConcurrentMapShard  *shard_      = _container_concurrent_map_shard(map, hashed_);
+    ConcurrentMapReader *reader_     = _container_concurrent_map_read_begin(map);
+    Bool                 found_      = false;
+
+    if (reader_) {
+        while (!_container_concurrent_map_try_search(shard_, hashed_, key, key_length_, out_data, &found_)) {
+#if defined(__SSE2__)
+            _mm_pause();
+#endif
+        }
+
+        _container_concurrent_map_read_end(reader_);
+        return found_;
+    }
+
+    _container_concurrent_map_lock(&shard_->_lock);
+
+    MapEntry *entry_ = _container_map_find(shard_->_table, hashed_, key, key_length_, NULL);
+    if (entry_ && out_data)
+        memcpy(out_data, _container_map_slot_data(shard_->_table, entry_), map->_data_size);
+
+    _container_concurrent_map_unlock(&shard_->_lock);
+    return (entry_ != NULL);
+}
+
+ContainerResult container_concurrent_map_construct(const ByteSize data_size, ConcurrentMap *out_new_map) {
+    if (!data_size || !out_new_map) return CONTAINER_ERROR_INVALID_PARAM;
+
+    ConcurrentMap map_        = NULL;
+    ByteSize      alloc_size_ = sizeof(struct Container_Concurrent_Map);
+    if (memory_zone_allocate_aligned(MEMORY_ZONE_CONTAINERS, alloc_size_, MAP_CACHE_LINE_SIZE, (VoidPtr *)&map_, NULL) != MEMORY_ZONE_SUCCESS)
+        return CONTAINER_ERROR_ALLOCATION_FAILED;
+
+    memset(map_, 0, alloc_size_);
+    map_->_epoch       = 1;
+    map_->_data_size   = data_size;
+    map_->_memory_size = alloc_size_;
+
+    for (ByteSize i = 0; i < CONTAINER_CONCURRENT_MAP_SHARDS; ++i) {
+        if (_container_map_allocate(sizeof(MapEntry), data_size, _container_map_default_capacity(), &map_->_shards[i]._table) != CONTAINER_SUCCESS) {
+            container_concurrent_map_destruct(map_);
+            return CONTAINER_ERROR_ALLOCATION_FAILED;
+        }
+    }
+
+    *out_new_map = map_;
+    return CONTAINER_SUCCESS;
+}
+
+// nothing may read or write the map while it goes
+ContainerResult container_concurrent_map_destruct(ConcurrentMap map) {
+    if (!map) return CONTAINER_ERROR_INVALID_PARAM;
+    if (!map->_memory_size) return CONTAINER_ERROR_NOT_ALLOCATED;
+
+    for (ByteSize i = 0; i < CONTAINER_CONCURRENT_MAP_SHARDS; ++i) {
+        ConcurrentMapShard *shard_ = &map->_shards[i];
+
+        if (_container_concurrent_map_reclaim(map, shard_) != CONTAINER_SUCCESS)
+            return CONTAINER_ERROR_DEALLOCATION_FAILED;
+
+        if (shard_->_table && (container_map_destruct(shard_->_table) != CONTAINER_SUCCESS))
+            return CONTAINER_ERROR_DEALLOCATION_FAILED;
+    }
+
+    if (memory_zone_deallocate_aligned(MEMORY_ZONE_CONTAINERS, map, map->_memory_size, MAP_CACHE_LINE_SIZE) != MEMORY_ZONE_SUCCESS)
+        return CONTAINER_ERROR_DEALLOCATION_FAILED;
+
+    return CONTAINER_SUCCESS;
+}
+
+ContainerResult container_concurrent_map_insert(ConcurrentMap map, ConstStr key, const VoidPtr data) {
+    return container_concurrent_map_insert_hashed(map, hash_str(key, CONTAINER_MAP_HASH_MODE), key, data);
+}
+
+// a full table is not grown in place: the grown copy is published and the old one retired
+ContainerResult container_concurrent_map_insert_hashed(ConcurrentMap map, const HashedInt hashed_key, ConstStr key, const VoidPtr data) {
+    if (!map || !key || !data) return CONTAINER_ERROR_INVALID_PARAM;
+    if (!map->_memory_size) return CONTAINER_ERROR_NOT_ALLOCATED;
+
+    ByteSize            key_length_ = strlen(key);
+    HashedInt           hashed_     = _container_map_mix(hashed_key);
+    ConcurrentMapShard *shard_      = _container_concurrent_map_shard(map, hashed_);
+    ByteSize            index_      = 0;
+    ContainerResult     result_     = CONTAINER_SUCCESS;
+
+    _container_concurrent_map_write_begin(shard_);
+
+    Map table_ = shard_->_table;
+    if (_container_map_find(table_, hashed_, key, key_length_, &index_))
+        result_ = CONTAINER_ERROR_MAP_KEY_ALREADY_EXISTS;
+
+    if ((result_ == CONTAINER_SUCCESS) && (table_->_size >= (table_->_capacity * 3) / 4)) {
+        Map grown_ = NULL;
+        result_    = _container_map_rehash(table_, table_->_capacity * 2, &grown_);
+
+        if (result_ == CONTAINER_SUCCESS) {
+            __atomic_store_n(&shard_->_table, grown_, __ATOMIC_RELEASE);
+            result_ = _container_concurrent_map_retire(map, shard_, table_, true);
+
+            table_ = grown_;
+            index_ = _container_map_find_empty(table_, hashed_);
+        }
+    }
+
+    if (result_ == CONTAINER_SUCCESS) {
+        MapEntry *entry_ = _container_map_slot(table_, index_);
+
+        if (key_length_ < MAP_INLINE_KEY_SIZE)
+            memcpy(entry_->_key._inline, key, key_length_ + 1);
+        else if (container_string_construct(key, &entry_->_key._string) != CONTAINER_SUCCESS)
+            result_ = CONTAINER_ERROR_ALLOCATION_FAILED;
+
+        if (result_ == CONTAINER_SUCCESS) {
+            entry_->_hashed_key = hashed_;
+            entry_->_key_length = key_length_;
+            memcpy(_container_map_slot_data(table_, entry_), data, map->_data_size);
+
+            _container_map_set_ctrl(table_, index_, MAP_CTRL_TAG(hashed_));
+            ++table_->_size;
+        }
+    }
+
+    ContainerResult end_ = _container_concurrent_map_write_end(map, shard_);
+    return (result_ != CONTAINER_SUCCESS) ? result_ : end_;
+}
+
+ContainerResult container_concurrent_map_remove(ConcurrentMap map, ConstStr key) {
+    return container_concurrent_map_remove_hashed(map, hash_str(key, CONTAINER_MAP_HASH_MODE), key);
+}
+
+ContainerResult container_concurrent_map_remove_hashed(ConcurrentMap map, const HashedInt hashed_key, ConstStr key) {
+    if (!map || !key) return CONTAINER_ERROR_INVALID_PARAM;
+    if (!map->_memory_size) return CONTAINER_ERROR_NOT_ALLOCATED;
+
+    HashedInt           hashed_ = _container_map_mix(hashed_key);
+    ConcurrentMapShard *shard_  = _container_concurrent_map_shard(map, hashed_);
+    ContainerResult     result_ = CONTAINER_SUCCESS;
+
+    _container_concurrent_map_write_begin(shard_);
+
+    MapEntry *entry_ = _container_map_find(shard_->_table, hashed_, key, strlen(key), NULL);
+    if (!entry_)
+        result_ = CONTAINER_ERROR_MAP_KEY_NOT_FOUND;
+
+    else {
+        // the key string goes the way of the tables, a reader may be comparing against it
+        if (entry_->_key_length >= MAP_INLINE_KEY_SIZE)
+            result_ = _container_concurrent_map_retire(map, shard_, entry_->_key._string, false);
+
+        if (result_ == CONTAINER_SUCCESS)
+            _container_map_erase(shard_->_table, entry_);
+    }
+
+    ContainerResult end_ = _container_concurrent_map_write_end(map, shard_);
+    return (result_ != CONTAINER_SUCCESS) ? result_ : end_;
+}
+
+ContainerResult container_concurrent_map_update(ConcurrentMap map, ConstStr key, const VoidPtr new_data) {
+    return container_concurrent_map_update_hashed(map, hash_str(key, CONTAINER_MAP_HASH_MODE), key, new_data);
+}
+
+ContainerResult container_concurrent_map_update_hashed(ConcurrentMap map, const HashedInt hashed_key, ConstStr key, const VoidPtr new_data) {
+    if (!map || !key || !new_data) return CONTAINER_ERROR_INVALID_PARAM;
+    if (!map->_memory_size) return CONTAINER_ERROR_NOT_ALLOCATED;
+
+    HashedInt           hashed_ = _container_map_mix(hashed_key);
+    ConcurrentMapShard *shard_  = _container_concurrent_map_shard(map, hashed_);
+    ContainerResult     result_ = CONTAINER_SUCCESS;
+
+    _container_concurrent_map_write_begin(shard_);
+
+    MapEntry *entry_ = _container_map_find(shard_->_table, hashed_, key, strlen(key), NULL);
+    if (!entry_)
+        result_ = CONTAINER_ERROR_MAP_KEY_NOT_FOUND;
+    else
+        memmove(_container_map_slot_data(shard_->_table, entry_), new_data, map->_data_size);
+
+    ContainerResult end_ = _container_concurrent_map_write_end(map, shard_);
+    return (result_ != CONTAINER_SUCCESS) ? result_ : end_;
+}
+
+ContainerResult container_concurrent_map_search(ConcurrentMap map, ConstStr key, VoidPtr *out_data) {
+    return container_concurrent_map_search_hashed(map, hash_str(key, CONTAINER_MAP_HASH_MODE), key, out_data);
+}
+
+ContainerResult container_concurrent_map_search_hashed(ConcurrentMap map, const HashedInt hashed_key, ConstStr key, VoidPtr *out_data) {
+    if (!map || !key || !out_data) return CONTAINER_ERROR_INVALID_PARAM;
+    if (!map->_memory_size) return CONTAINER_ERROR_NOT_ALLOCATED;
+
+    return _container_concurrent_map_search(map, hashed_key, key, out_data) ? CONTAINER_SUCCESS : CONTAINER_ERROR_MAP_KEY_NOT_FOUND;
+}
+
+Bool container_concurrent_map_contains(ConcurrentMap map, ConstStr key) {
+    return container_concurrent_map_contains_hashed(map, hash_str(key, CONTAINER_MAP_HASH_MODE), key);
+}
+
+Bool container_concurrent_map_contains_hashed(ConcurrentMap map, const HashedInt hashed_key, ConstStr key) {
+    if (!map || !key) return false;
+    if (!map->_memory_size) return false;
+
+    return _container_concurrent_map_search(map, hashed_key, key, NULL);
+}
+
+// retired memory is otherwise only freed by the next write to its shard
+ContainerResult container_concurrent_map_collect(ConcurrentMap map) {
+    if (!map) return CONTAINER_ERROR_INVALID_PARAM;
+    if (!map->_memory_size) return CONTAINER_ERROR_NOT_ALLOCATED;
+
+    for (ByteSize i = 0; i < CONTAINER_CONCURRENT_MAP_SHARDS; ++i) {
+        ConcurrentMapShard *shard_ = &map->_shards[i];
+
+        _container_concurrent_map_lock(&shard_->_lock);
+        ContainerResult reclaim_ = _container_concurrent_map_reclaim(map, shard_);
+        _container_concurrent_map_unlock(&shard_->_lock);
+
+        if (reclaim_ != CONTAINER_SUCCESS)
+            return reclaim_;
+    }
+
+    return CONTAINER_SUCCESS;
+}
+
+Bool container_concurrent_map_empty(ConcurrentMap map) {
+    return !container_concurrent_map_size(map);
+}
+
+// only a snapshot while writers are busy; the tables are read like a search reads them, so a resize can't free one under us
+ByteSize container_concurrent_map_size(ConcurrentMap map) {
+    if (!map) return 0;
+
+    ByteSize             size_   = 0;
+    ConcurrentMapReader *reader_ = _container_concurrent_map_read_begin(map);
+
+    for (ByteSize i = 0; i < CONTAINER_CONCURRENT_MAP_SHARDS; ++i) {
+        ConcurrentMapShard *shard_ = &map->_shards[i];
+
+        // threads past the last reader slot take the shard lock instead
+        if (!reader_) _container_concurrent_map_lock(&shard_->_lock);
+        size_ += __atomic_load_n(&__atomic_load_n(&shard_->_table, __ATOMIC_ACQUIRE)->_size, __ATOMIC_RELAXED);
+        if (!reader_) _container_concurrent_map_unlock(&shard_->_lock);
+    }
+
+    _container_concurrent_map_read_end(reader_);
+    return size_;
+}
+
+ByteSize container_concurrent_map_data_size(ConcurrentMap map) {
+    return (!map ? 0 : map->_data_size);
 }
@@ -1,21 +1,113 @@
 #pragma once
 
 #include "vytal/defines/core/containers.h"
+#include "vytal/defines/core/hash.h"
 #include "vytal/defines/core/memory.h"
 #include "vytal/defines/shared.h"
 
+// the *_hashed calls take hash_str(key, CONTAINER_MAP_HASH_MODE) or HASH_LITERAL(key)
+#define CONTAINER_MAP_HASH_MODE HASH_MODE_FNV1A64
+
 VYTAL_API ContainerResult container_map_construct(const ByteSize data_size, Map *out_new_map);
 VYTAL_API ContainerResult container_map_destruct(Map map);
 
 VYTAL_API ContainerResult container_map_insert(Map *map, ConstStr key, const VoidPtr data);
+VYTAL_API ContainerResult container_map_insert_many(Map *map, ConstStr *keys, const VoidPtr data, const ByteSize count);
 VYTAL_API ContainerResult container_map_remove(Map *map, ConstStr key);
 VYTAL_API ContainerResult container_map_update(Map *map, ConstStr key, const VoidPtr new_data);
 VYTAL_API ContainerResult container_map_search(Map map, ConstStr key, VoidPtr *out_data);
 
+VYTAL_API ContainerResult container_map_insert_hashed(Map *map, const HashedInt hashed_key, ConstStr key, const VoidPtr data);
+VYTAL_API ContainerResult container_map_remove_hashed(Map *map, const HashedInt hashed_key, ConstStr key);
+VYTAL_API ContainerResult container_map_update_hashed(Map *map, const HashedInt hashed_key, ConstStr key, const VoidPtr new_data);
+VYTAL_API ContainerResult container_map_search_hashed(Map map, const HashedInt hashed_key, ConstStr key, VoidPtr *out_data);
+
+VYTAL_API ContainerResult container_map_reserve(Map *map, const ByteSize count);
+VYTAL_API ContainerResult container_map_shrink_to_fit(Map *map);
+
 VYTAL_API Bool     container_map_contains(Map map, ConstStr key);
+VYTAL_API Bool     container_map_contains_hashed(Map map, const HashedInt hashed_key, ConstStr key);
 VYTAL_API Bool     container_map_empty(Map map);
 VYTAL_API Bool     container_map_full(Map map);
 VYTAL_API ByteSize container_map_size(Map map);
 VYTAL_API ByteSize container_map_capacity(Map map);
 VYTAL_API ByteSize container_map_data_size(Map map);
 VYTAL_API VoidPtr  container_map_at_index(Map map, const ByteSize index);
+
+VYTAL_API Bool container_map_iter_begin(Map map, MapIterator *out_iter);
+VYTAL_API Bool container_map_iter_next(Map map, MapIterator *iter);
+
+// keyed by integer ids or pointers ((UInt64)(UIntPtr)ptr); unlike container_map_search(),
+// a missing key is reported as CONTAINER_ERROR_MAP_KEY_NOT_FOUND
+VYTAL_API ContainerResult container_id_map_construct(const ByteSize data_size, IdMap *out_new_map);
+VYTAL_API ContainerResult container_id_map_destruct(IdMap map);
+
+VYTAL_API ContainerResult container_id_map_insert(IdMap *map, const UInt64 key, const VoidPtr data);
+VYTAL_API ContainerResult container_id_map_insert_many(IdMap *map, const UInt64 *keys, const VoidPtr data, const ByteSize count);
+VYTAL_API ContainerResult container_id_map_remove(IdMap *map, const UInt64 key);
+VYTAL_API ContainerResult container_id_map_update(IdMap *map, const UInt64 key, const VoidPtr new_data);
+VYTAL_API ContainerResult container_id_map_search(IdMap map, const UInt64 key, VoidPtr *out_data);
+
+VYTAL_API ContainerResult container_id_map_reserve(IdMap *map, const ByteSize count);
+VYTAL_API ContainerResult container_id_map_shrink_to_fit(IdMap *map);
+
+VYTAL_API Bool     container_id_map_contains(IdMap map, const UInt64 key);
+VYTAL_API Bool     container_id_map_empty(IdMap map);
+VYTAL_API ByteSize container_id_map_size(IdMap map);
+VYTAL_API ByteSize container_id_map_capacity(IdMap map);
+VYTAL_API ByteSize container_id_map_data_size(IdMap map);
+
+VYTAL_API Bool container_id_map_iter_begin(IdMap map, IdMapIterator *out_iter);
+VYTAL_API Bool container_id_map_iter_next(IdMap map, IdMapIterator *iter);
+
+// entries stay dense and in insertion order, with the hash table holding only their positions;
+// a missing key is reported as CONTAINER_ERROR_MAP_KEY_NOT_FOUND
+VYTAL_API ContainerResult container_ordered_map_construct(const ByteSize data_size, OrderedMap *out_new_map);
+VYTAL_API ContainerResult container_ordered_map_destruct(OrderedMap map);
+
+VYTAL_API ContainerResult container_ordered_map_insert(OrderedMap *map, ConstStr key, const VoidPtr data);
+VYTAL_API ContainerResult container_ordered_map_remove(OrderedMap *map, ConstStr key);
+VYTAL_API ContainerResult container_ordered_map_update(OrderedMap *map, ConstStr key, const VoidPtr new_data);
+VYTAL_API ContainerResult container_ordered_map_search(OrderedMap map, ConstStr key, VoidPtr *out_data);
+
+VYTAL_API ContainerResult container_ordered_map_insert_hashed(OrderedMap *map, const HashedInt hashed_key, ConstStr key, const VoidPtr data);
+VYTAL_API ContainerResult container_ordered_map_remove_hashed(OrderedMap *map, const HashedInt hashed_key, ConstStr key);
+VYTAL_API ContainerResult container_ordered_map_update_hashed(OrderedMap *map, const HashedInt hashed_key, ConstStr key, const VoidPtr new_data);
+VYTAL_API ContainerResult container_ordered_map_search_hashed(OrderedMap map, const HashedInt hashed_key, ConstStr key, VoidPtr *out_data);
+
+VYTAL_API ContainerResult container_ordered_map_reserve(OrderedMap *map, const ByteSize count);
+
+VYTAL_API Bool     container_ordered_map_contains(OrderedMap map, ConstStr key);
+VYTAL_API Bool     container_ordered_map_contains_hashed(OrderedMap map, const HashedInt hashed_key, ConstStr key);
+VYTAL_API Bool     container_ordered_map_empty(OrderedMap map);
+VYTAL_API ByteSize container_ordered_map_size(OrderedMap map);
+VYTAL_API ByteSize container_ordered_map_capacity(OrderedMap map);
+VYTAL_API ByteSize container_ordered_map_data_size(OrderedMap map);
+
+VYTAL_API Bool container_ordered_map_iter_begin(OrderedMap map, MapIterator *out_iter);
+VYTAL_API Bool container_ordered_map_iter_next(OrderedMap map, MapIterator *iter);
+
+// readers run lock-free next to writers, which only lock the shard of their key; nothing a reader may
+// still be looking at is freed before it is done. writers to different shards would allocate at the same time,
+// so all writes must come from a single thread unless the containers and strings zones are declared concurrent.
+// a missing key is reported as CONTAINER_ERROR_MAP_KEY_NOT_FOUND
+VYTAL_API ContainerResult container_concurrent_map_construct(const ByteSize data_size, ConcurrentMap *out_new_map);
+VYTAL_API ContainerResult container_concurrent_map_destruct(ConcurrentMap map);
+
+VYTAL_API ContainerResult container_concurrent_map_insert(ConcurrentMap map, ConstStr key, const VoidPtr data);
+VYTAL_API ContainerResult container_concurrent_map_remove(ConcurrentMap map, ConstStr key);
+VYTAL_API ContainerResult container_concurrent_map_update(ConcurrentMap map, ConstStr key, const VoidPtr new_data);
+VYTAL_API ContainerResult container_concurrent_map_search(ConcurrentMap map, ConstStr key, VoidPtr *out_data);
+
+VYTAL_API ContainerResult container_concurrent_map_insert_hashed(ConcurrentMap map, const HashedInt hashed_key, ConstStr key, const VoidPtr data);
+VYTAL_API ContainerResult container_concurrent_map_remove_hashed(ConcurrentMap map, const HashedInt hashed_key, ConstStr key);
+VYTAL_API ContainerResult container_concurrent_map_update_hashed(ConcurrentMap map, const HashedInt hashed_key, ConstStr key, const VoidPtr new_data);
+VYTAL_API ContainerResult container_concurrent_map_search_hashed(ConcurrentMap map, const HashedInt hashed_key, ConstStr key, VoidPtr *out_data);
+
+VYTAL_API ContainerResult container_concurrent_map_collect(ConcurrentMap map);
+
+VYTAL_API Bool     container_concurrent_map_contains(ConcurrentMap map, ConstStr key);
+VYTAL_API Bool     container_concurrent_map_contains_hashed(ConcurrentMap map, const HashedInt hashed_key, ConstStr key);
+VYTAL_API Bool     container_concurrent_map_empty(ConcurrentMap map);
+VYTAL_API ByteSize container_concurrent_map_size(ConcurrentMap map);
+VYTAL_API ByteSize container_concurrent_map_data_size(ConcurrentMap map);
@@ -0,0 +1,266 @@
+#include "ring.h"
+
+#include <string.h>
+
+#include "vytal/core/memory/zone/memory_zone.h"
+
+// the producer's and the consumer's state each sit on a cache line of their own, so pushing
+// and popping from different threads don't keep stealing the same line from each other
+#define RING_CACHE_LINE_SIZE 64
+
+// smallest ring the mpmc slot sequences can tell full from empty in
+#define RING_MIN_CAPACITY 2
+
+typedef union Container_Ring_Cursor {
+    struct {
+        volatile UInt64 _position;
+        UInt64          _cached;  // the other side's last seen position, private to this side
+    };
+    UInt8 _line[RING_CACHE_LINE_SIZE];
+} RingCursor;
+
+typedef union Container_Ring_Shared {
+    struct {
+        BytePtr  _slots;
+        UInt64   _mask;
+        ByteSize _data_size;
+        ByteSize _slot_size;
+
+        // used for allocations/deallocations
+        ByteSize _memory_size;
+    };
+    UInt8 _line[RING_CACHE_LINE_SIZE];
+} RingShared;
+
+struct Container_Spsc_Ring {
+    RingShared _shared;
+    RingCursor _head;  // next slot to pop, caches the tail
+    RingCursor _tail;  // next slot to push, caches the head
+};
+
+// every mpmc slot carries a sequence: equal to the position a push may take it at,
+// one past it once the data is in, and a lap ahead again once popped
+struct Container_Mpmc_Ring {
+    RingShared _shared;
+    RingCursor _head;
+    RingCursor _tail;
+};
+
+VYTAL_INLINE ByteSize _container_ring_capacity(const ByteSize capacity) {
+    ByteSize capacity_ = RING_MIN_CAPACITY;
+    while (capacity_ < capacity) capacity_ <<= 1;
+
+    return capacity_;
+}
+
+// lays the header and the slots out in one cache-line aligned block
+VYTAL_INLINE ContainerResult _container_ring_allocate(const ByteSize header_size, const ByteSize slot_size, const ByteSize data_size, const ByteSize capacity, VoidPtr *out_ring) {
+    if (capacity > ((ByteSize)1 << ((sizeof(ByteSize) * 8) - 1))) return CONTAINER_ERROR_INVALID_PARAM;
+
+    ByteSize capacity_ = _container_ring_capacity(capacity);
+
+    // the block size (padding included) has to fit a ByteSize, or it wraps to something far too small for the slots
+    if (capacity_ > ((ByteSize)-1 - header_size - RING_CACHE_LINE_SIZE) / slot_size) return CONTAINER_ERROR_INVALID_PARAM;
+
+    ByteSize alloc_size_ = VYTAL_APPLY_ALIGNMENT(header_size + (slot_size * capacity_), RING_CACHE_LINE_SIZE);
+    VoidPtr  ring_       = NULL;
+
+    if (memory_zone_allocate_aligned(MEMORY_ZONE_CONTAINERS, alloc_size_, RING_CACHE_LINE_SIZE, &ring_, NULL) != MEMORY_ZONE_SUCCESS)
+        return CONTAINER_ERROR_ALLOCATION_FAILED;
+
+    memset(ring_, 0, header_size);
+
+    RingShared *shared_   = ring_;
+    shared_->_slots       = (BytePtr)ring_ + header_size;
+    shared_->_mask        = capacity_ - 1;
+    shared_->_data_size   = data_size;
+    shared_->_slot_size   = slot_size;
+    shared_->_memory_size = alloc_size_;
+
+    *out_ring = ring_;
+    return CONTAINER_SUCCESS;
+}
+
+VYTAL_INLINE ContainerResult _container_ring_deallocate(VoidPtr ring, RingShared *shared) {
+    if (memory_zone_deallocate_aligned(MEMORY_ZONE_CONTAINERS, ring, shared->_memory_size, RING_CACHE_LINE_SIZE) != MEMORY_ZONE_SUCCESS)
+        return CONTAINER_ERROR_DEALLOCATION_FAILED;
+
+    return CONTAINER_SUCCESS;
+}
+
+// the head goes first, it never passes the tail; pushes and pops landing in between can still
+// make the difference overshoot, hence the clamp
+VYTAL_INLINE ByteSize _container_ring_size(RingShared *shared, RingCursor *head, RingCursor *tail) {
+    UInt64 head_ = __atomic_load_n(&head->_position, __ATOMIC_ACQUIRE);
+    UInt64 tail_ = __atomic_load_n(&tail->_position, __ATOMIC_ACQUIRE);
+
+    return (tail_ - head_ > shared->_mask) ? (ByteSize)(shared->_mask + 1) : (ByteSize)(tail_ - head_);
+}
+
+// ---------------------------------------------------------------------- //
+
+ContainerResult container_spsc_ring_construct(const ByteSize data_size, const ByteSize capacity, SpscRing *out_new_ring) {
+    if (!data_size || !capacity || !out_new_ring) return CONTAINER_ERROR_INVALID_PARAM;
+
+    return _container_ring_allocate(sizeof(struct Container_Spsc_Ring), data_size, data_size, capacity, (VoidPtr *)out_new_ring);
+}
+
+// neither side may use the ring while it goes
+ContainerResult container_spsc_ring_destruct(SpscRing ring) {
+    if (!ring) return CONTAINER_ERROR_INVALID_PARAM;
+    if (!ring->_shared._memory_size) return CONTAINER_ERROR_NOT_ALLOCATED;
+
+    return _container_ring_deallocate(ring, &ring->_shared);
+}
+
+// the head is only read again when the cached one says the ring is full
+ContainerResult container_spsc_ring_push(SpscRing ring, const VoidPtr data) {
+    if (!ring || !data) return CONTAINER_ERROR_INVALID_PARAM;
+
+    UInt64 tail_ = ring->_tail._position;
+
+    if (tail_ - ring->_tail._cached > ring->_shared._mask) {
+        ring->_tail._cached = __atomic_load_n(&ring->_head._position, __ATOMIC_ACQUIRE);
+        if (tail_ - ring->_tail._cached > ring->_shared._mask) return CONTAINER_ERROR_RING_FULL;
+    }
+
+    memcpy(ring->_shared._slots + ((tail_ & ring->_shared._mask) * ring->_shared._slot_size), data, ring->_shared._data_size);
+    __atomic_store_n(&ring->_tail._position, tail_ + 1, __ATOMIC_RELEASE);
+
+    return CONTAINER_SUCCESS;
+}
+
+// and the tail only when the cached one says it is empty
+ContainerResult container_spsc_ring_pop(SpscRing ring, VoidPtr out_data) {
+    if (!ring || !out_data) return CONTAINER_ERROR_INVALID_PARAM;
+
+    UInt64 head_ = ring->_head._position;
+
+    if (head_ == ring->_head._cached) {
+        ring->_head._cached = __atomic_load_n(&ring->_tail._position, __ATOMIC_ACQUIRE);
+        if (head_ == ring->_head._cached) return CONTAINER_ERROR_EMPTY_DATA;
+    }
+
+    memcpy(out_data, ring->_shared._slots + ((head_ & ring->_shared._mask) * ring->_shared._slot_size), ring->_shared._data_size);
+    __atomic_store_n(&ring->_head._position, head_ + 1, __ATOMIC_RELEASE);
+
+    return CONTAINER_SUCCESS;
+}
+
+ByteSize container_spsc_ring_size(SpscRing ring) {
+    return (!ring) ? 0 : _container_ring_size(&ring->_shared, &ring->_head, &ring->_tail);
+}
+
+ByteSize container_spsc_ring_capacity(SpscRing ring) {
+    return (!ring) ? 0 : (ByteSize)(ring->_shared._mask + 1);
+}
+
+ByteSize container_spsc_ring_data_size(SpscRing ring) {
+    return (!ring) ? 0 : ring->_shared._data_size;
+}
+
+Bool container_spsc_ring_empty(SpscRing ring) {
+    return (!ring) ? true : (_container_ring_size(&ring->_shared, &ring->_head, &ring->_tail) == 0);
+}
+
+// ---------------------------------------------------------------------- //
+
+VYTAL_INLINE volatile UInt64 *_container_mpmc_ring_sequence(MpmcRing ring, const UInt64 position) {
+    return (volatile UInt64 *)(ring->_shared._slots + ((position & ring->_shared._mask) * ring->_shared._slot_size));
+}
+
+ContainerResult container_mpmc_ring_construct(const ByteSize data_size, const ByteSize capacity, MpmcRing *out_new_ring) {
+    if (!data_size || !capacity || !out_new_ring) return CONTAINER_ERROR_INVALID_PARAM;
+
+    // the sequence leads every slot, and the padded slot size must not wrap either
+    if (data_size > (ByteSize)-1 - (2 * sizeof(UInt64))) return CONTAINER_ERROR_INVALID_PARAM;
+    ByteSize slot_size_ = VYTAL_APPLY_ALIGNMENT(sizeof(UInt64) + data_size, sizeof(UInt64));
+
+    ContainerResult allocate_ = _container_ring_allocate(sizeof(struct Container_Mpmc_Ring), slot_size_, data_size, capacity, (VoidPtr *)out_new_ring);
+    if (allocate_ != CONTAINER_SUCCESS)
+        return allocate_;
+
+    for (UInt64 i = 0; i <= (*out_new_ring)->_shared._mask; ++i) *_container_mpmc_ring_sequence(*out_new_ring, i) = i;
+
+    return CONTAINER_SUCCESS;
+}
+
+// nothing may push or pop while it goes
+ContainerResult container_mpmc_ring_destruct(MpmcRing ring) {
+    if (!ring) return CONTAINER_ERROR_INVALID_PARAM;
+    if (!ring->_shared._memory_size) return CONTAINER_ERROR_NOT_ALLOCATED;
+
+    return _container_ring_deallocate(ring, &ring->_shared);
+}
+
+// a producer claims the tail position whose slot is free on this lap, then publishes the data through the sequence
+ContainerResult container_mpmc_ring_push(MpmcRing ring, const VoidPtr data) {
+    if (!ring || !data) return CONTAINER_ERROR_INVALID_PARAM;
+
+    UInt64           position_ = __atomic_load_n(&ring->_tail._position, __ATOMIC_RELAXED);
+    volatile UInt64 *sequence_ = NULL;
+
+    for (;;) {
+        sequence_ = _container_mpmc_ring_sequence(ring, position_);
+        Int64 lag_ = (Int64)(__atomic_load_n(sequence_, __ATOMIC_ACQUIRE) - position_);
+
+        if (lag_ == 0) {
+            if (__atomic_compare_exchange_n(&ring->_tail._position, &position_, position_ + 1, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+                break;
+        } else if (lag_ < 0) {
+            // the slot still holds last lap's element
+            return CONTAINER_ERROR_RING_FULL;
+        } else {
+            position_ = __atomic_load_n(&ring->_tail._position, __ATOMIC_RELAXED);
+        }
+    }
+
+    memcpy((BytePtr)sequence_ + sizeof(UInt64), data, ring->_shared._data_size);
+    __atomic_store_n(sequence_, position_ + 1, __ATOMIC_RELEASE);
+
+    return CONTAINER_SUCCESS;
+}
+
+// a consumer claims the head position whose slot has been published, then hands the slot to the next lap
+ContainerResult container_mpmc_ring_pop(MpmcRing ring, VoidPtr out_data) {
+    if (!ring || !out_data) return CONTAINER_ERROR_INVALID_PARAM;
+
+    UInt64           position_ = __atomic_load_n(&ring->_head._position, __ATOMIC_RELAXED);
+    volatile UInt64 *sequence_ = NULL;
+
+    for (;;) {
+        sequence_ = _container_mpmc_ring_sequence(ring, position_);
+        Int64 lag_ = (Int64)(__atomic_load_n(sequence_, __ATOMIC_ACQUIRE) - (position_ + 1));
+
+        if (lag_ == 0) {
+            if (__atomic_compare_exchange_n(&ring->_head._position, &position_, position_ + 1, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+                break;
+        } else if (lag_ < 0) {
+            // nothing has been published there yet
+            return CONTAINER_ERROR_EMPTY_DATA;
+        } else {
+            position_ = __atomic_load_n(&ring->_head._position, __ATOMIC_RELAXED);
+        }
+    }
+
+    memcpy(out_data, (BytePtr)sequence_ + sizeof(UInt64), ring->_shared._data_size);
+    __atomic_store_n(sequence_, position_ + ring->_shared._mask + 1, __ATOMIC_RELEASE);
+
+    return CONTAINER_SUCCESS;
+}
+
+ByteSize container_mpmc_ring_size(MpmcRing ring) {
+    return (!ring) ? 0 : _container_ring_size(&ring->_shared, &ring->_head, &ring->_tail);
+}
+
+ByteSize container_mpmc_ring_capacity(MpmcRing ring) {
+    return (!ring) ? 0 : (ByteSize)(ring->_shared._mask + 1);
+}
+
+ByteSize container_mpmc_ring_data_size(MpmcRing ring) {
+    return (!ring) ? 0 : ring->_shared._data_size;
+}
+
+Bool container_mpmc_ring_empty(MpmcRing ring) {
+    return (!ring) ? true : (_container_ring_size(&ring->_shared, &ring->_head, &ring->_tail) == 0);
+}
@@ -0,0 +1,33 @@
+#pragma once
+
+#include "vytal/defines/core/containers.h"
+#include "vytal/defines/core/memory.h"
+#include "vytal/defines/shared.h"
+
+// bounded lock-free rings; capacities round up to a power of two and elements are copied in and out by data_size.
+// nothing blocks: pushing to a full ring returns CONTAINER_ERROR_RING_FULL and popping an empty one
+// CONTAINER_ERROR_EMPTY_DATA. only construct and destruct touch the zone, so it doesn't need to be concurrent
+
+// one producer thread and one consumer thread
+VYTAL_API ContainerResult container_spsc_ring_construct(const ByteSize data_size, const ByteSize capacity, SpscRing *out_new_ring);
+VYTAL_API ContainerResult container_spsc_ring_destruct(SpscRing ring);
+
+VYTAL_API ContainerResult container_spsc_ring_push(SpscRing ring, const VoidPtr data);
+VYTAL_API ContainerResult container_spsc_ring_pop(SpscRing ring, VoidPtr out_data);
+
+VYTAL_API ByteSize container_spsc_ring_size(SpscRing ring);
+VYTAL_API ByteSize container_spsc_ring_capacity(SpscRing ring);
+VYTAL_API ByteSize container_spsc_ring_data_size(SpscRing ring);
+VYTAL_API Bool     container_spsc_ring_empty(SpscRing ring);
+
+// any number of producer and consumer threads; size and empty are only a snapshot while others push and pop
+VYTAL_API ContainerResult container_mpmc_ring_construct(const ByteSize data_size, const ByteSize capacity, MpmcRing *out_new_ring);
+VYTAL_API ContainerResult container_mpmc_ring_destruct(MpmcRing ring);
+
+VYTAL_API ContainerResult container_mpmc_ring_push(MpmcRing ring, const VoidPtr data);
+VYTAL_API ContainerResult container_mpmc_ring_pop(MpmcRing ring, VoidPtr out_data);
+
+VYTAL_API ByteSize container_mpmc_ring_size(MpmcRing ring);
+VYTAL_API ByteSize container_mpmc_ring_capacity(MpmcRing ring);
+VYTAL_API ByteSize container_mpmc_ring_data_size(MpmcRing ring);
+VYTAL_API Bool     container_mpmc_ring_empty(MpmcRing ring);
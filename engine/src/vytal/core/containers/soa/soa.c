@@ -0,0 +1,277 @@
+#include "soa.h"
+
+#include <string.h>
+
+#include "vytal/core/memory/zone/memory_zone.h"
+
+typedef struct Container_SoA_Column {
+    ByteSize _data_size;
+    ByteSize _offset;  // from the start of the block
+} SoAColumn;
+
+struct Container_SoA {
+    ByteSize _column_count;
+    ByteSize _size;
+    ByteSize _capacity;
+
+    // used for allocations/deallocations
+    ByteSize _memory_size;
+
+    SoAColumn _columns[];
+};
+
+VYTAL_INLINE ByteSize _container_soa_header_size(const ByteSize column_count) {
+    return sizeof(struct Container_SoA) + (sizeof(SoAColumn) * column_count);
+}
+
+// every stream is padded out to the alignment, which keeps the next one aligned as well
+VYTAL_INLINE ByteSize _container_soa_stream_size(const ByteSize data_size, const ByteSize capacity) {
+    return VYTAL_APPLY_ALIGNMENT(data_size * capacity, CONTAINER_SOA_ALIGNMENT);
+}
+
+VYTAL_INLINE BytePtr _container_soa_stream(SoA soa, const ByteSize column) {
+    return (BytePtr)soa + soa->_columns[column]._offset;
+}
+
+// the block's address is only known once allocated, so there is room for the worst-case lead-in to the first stream
+VYTAL_INLINE ByteSize _container_soa_alloc_size(const SoAColumn *columns, const ByteSize column_count, const ByteSize capacity) {
+    ByteSize alloc_size_ = _container_soa_header_size(column_count) + CONTAINER_SOA_ALIGNMENT - 1;
+
+    for (ByteSize i = 0; i < column_count; ++i)
+        alloc_size_ += _container_soa_stream_size(columns[i]._data_size, capacity);
+
+    return VYTAL_APPLY_ALIGNMENT(alloc_size_, MEMORY_ALIGNMENT_SIZE);
+}
+
+// places the streams back to back, starting at the first aligned address past the column table
+VYTAL_INLINE void _container_soa_layout(SoA soa, const ByteSize capacity) {
+    UIntPtr  base_   = (UIntPtr)soa;
+    ByteSize offset_ = VYTAL_APPLY_ALIGNMENT(base_ + _container_soa_header_size(soa->_column_count), CONTAINER_SOA_ALIGNMENT) - base_;
+
+    for (ByteSize i = 0; i < soa->_column_count; ++i) {
+        soa->_columns[i]._offset = offset_;
+        offset_ += _container_soa_stream_size(soa->_columns[i]._data_size, capacity);
+    }
+}
+
+VYTAL_INLINE ContainerResult _container_soa_resize(SoA *soa, const ByteSize new_capacity) {
+    SoA old_soa_ = *soa;
+    SoA new_soa_ = NULL;
+
+    ByteSize base_new_alloc_size_ = _container_soa_alloc_size(old_soa_->_columns, old_soa_->_column_count, new_capacity);
+    ByteSize new_alloc_size_      = 0;
+
+    // grown in place, the first stream stays where it is and the others move up; walking them back to front
+    // means no stream is overwritten before it has moved
+    if (memory_zone_extend(MEMORY_ZONE_CONTAINERS, old_soa_, old_soa_->_memory_size, base_new_alloc_size_, &new_alloc_size_) == MEMORY_ZONE_SUCCESS) {
+        ByteSize end_ = old_soa_->_columns[0]._offset;
+
+        for (ByteSize i = 0; i < old_soa_->_column_count; ++i)
+            end_ += _container_soa_stream_size(old_soa_->_columns[i]._data_size, new_capacity);
+
+        for (ByteSize i = old_soa_->_column_count; i-- > 0;) {
+            SoAColumn *column_ = &old_soa_->_columns[i];
+            end_ -= _container_soa_stream_size(column_->_data_size, new_capacity);
+
+            memmove((BytePtr)old_soa_ + end_, (BytePtr)old_soa_ + column_->_offset, column_->_data_size * old_soa_->_size);
+            column_->_offset = end_;
+        }
+
+        old_soa_->_capacity    = new_capacity;
+        old_soa_->_memory_size = new_alloc_size_;
+        return CONTAINER_SUCCESS;
+    }
+
+    if (memory_zone_allocate(MEMORY_ZONE_CONTAINERS, base_new_alloc_size_, (VoidPtr *)&new_soa_, &new_alloc_size_) != MEMORY_ZONE_SUCCESS)
+        return CONTAINER_ERROR_ALLOCATION_FAILED;
+
+    memcpy(new_soa_, old_soa_, _container_soa_header_size(old_soa_->_column_count));
+    new_soa_->_capacity    = new_capacity;
+    new_soa_->_memory_size = new_alloc_size_;
+
+    _container_soa_layout(new_soa_, new_capacity);
+
+    for (ByteSize i = 0; i < old_soa_->_column_count; ++i)
+        memcpy(_container_soa_stream(new_soa_, i), _container_soa_stream(old_soa_, i), old_soa_->_columns[i]._data_size * old_soa_->_size);
+
+    if (memory_zone_deallocate(MEMORY_ZONE_CONTAINERS, old_soa_, old_soa_->_memory_size) != MEMORY_ZONE_SUCCESS)
+        return CONTAINER_ERROR_DEALLOCATION_FAILED;
+
+    *soa = new_soa_;
+    return CONTAINER_SUCCESS;
+}
+
+// makes room for count rows, at least a resize factor's worth so repeated calls stay amortized
+VYTAL_INLINE ContainerResult _container_soa_grow(SoA *soa, const ByteSize count) {
+    if (count <= (*soa)->_capacity) return CONTAINER_SUCCESS;
+
+    ByteSize new_capacity_ = (*soa)->_capacity * CONTAINER_RESIZE_FACTOR;
+    return _container_soa_resize(soa, (new_capacity_ > count) ? new_capacity_ : count);
+}
+
+ContainerResult container_soa_construct(const ByteSize *column_sizes, const ByteSize column_count, SoA *out_new_soa) {
+    if (!column_sizes || !column_count || !out_new_soa) return CONTAINER_ERROR_INVALID_PARAM;
+
+    for (ByteSize i = 0; i < column_count; ++i) {
+        if (!column_sizes[i]) return CONTAINER_ERROR_INVALID_PARAM;
+    }
+
+    // the column table is not in place yet, so the block is sized off column_sizes
+    ByteSize alloc_size_ = _container_soa_header_size(column_count) + CONTAINER_SOA_ALIGNMENT - 1;
+
+    for (ByteSize i = 0; i < column_count; ++i)
+        alloc_size_ += _container_soa_stream_size(column_sizes[i], CONTAINER_DEFAULT_CAPACITY);
+
+    alloc_size_ = VYTAL_APPLY_ALIGNMENT(alloc_size_, MEMORY_ALIGNMENT_SIZE);
+
+    if (memory_zone_allocate_zeroed(MEMORY_ZONE_CONTAINERS, alloc_size_, (VoidPtr *)out_new_soa, &alloc_size_) != MEMORY_ZONE_SUCCESS)
+        return CONTAINER_ERROR_ALLOCATION_FAILED;
+
+    (*out_new_soa)->_column_count = column_count;
+    (*out_new_soa)->_size         = 0;
+    (*out_new_soa)->_capacity     = CONTAINER_DEFAULT_CAPACITY;
+    (*out_new_soa)->_memory_size  = alloc_size_;
+
+    for (ByteSize i = 0; i < column_count; ++i) (*out_new_soa)->_columns[i]._data_size = column_sizes[i];
+
+    _container_soa_layout(*out_new_soa, CONTAINER_DEFAULT_CAPACITY);
+    return CONTAINER_SUCCESS;
+}
+
+ContainerResult container_soa_destruct(SoA soa) {
+    if (!soa) return CONTAINER_ERROR_INVALID_PARAM;
+    if (!soa->_memory_size) return CONTAINER_ERROR_NOT_ALLOCATED;
+
+    if (memory_zone_deallocate(MEMORY_ZONE_CONTAINERS, soa, soa->_memory_size) != MEMORY_ZONE_SUCCESS)
+        return CONTAINER_ERROR_DEALLOCATION_FAILED;
+
+    return CONTAINER_SUCCESS;
+}
+
+ContainerResult container_soa_push(SoA *soa, const VoidPtr *values) {
+    if (!soa) return CONTAINER_ERROR_INVALID_PARAM;
+    if (!(*soa)->_memory_size) return CONTAINER_ERROR_NOT_ALLOCATED;
+
+    ContainerResult grow_ = _container_soa_grow(soa, (*soa)->_size + 1);
+    if (grow_ != CONTAINER_SUCCESS)
+        return grow_;
+
+    for (ByteSize i = 0; i < (*soa)->_column_count; ++i) {
+        ByteSize data_size_ = (*soa)->_columns[i]._data_size;
+        BytePtr  push_addr_ = _container_soa_stream(*soa, i) + (data_size_ * (*soa)->_size);
+
+        if (values && values[i])
+            memcpy(push_addr_, values[i], data_size_);
+        else
+            memset(push_addr_, 0, data_size_);
+    }
+
+    ++(*soa)->_size;
+    return CONTAINER_SUCCESS;
+}
+
+ContainerResult container_soa_pop(SoA *soa) {
+    if (!soa) return CONTAINER_ERROR_INVALID_PARAM;
+    if (!(*soa)->_memory_size) return CONTAINER_ERROR_NOT_ALLOCATED;
+    if (!(*soa)->_size) return CONTAINER_ERROR_EMPTY_DATA;
+
+    --(*soa)->_size;
+    return CONTAINER_SUCCESS;
+}
+
+// the last row moves into the hole in every column, so rows don't keep their order
+ContainerResult container_soa_swap_remove(SoA *soa, const ByteSize index) {
+    if (!soa) return CONTAINER_ERROR_INVALID_PARAM;
+    if (!(*soa)->_memory_size) return CONTAINER_ERROR_NOT_ALLOCATED;
+    if (!(*soa)->_size) return CONTAINER_ERROR_EMPTY_DATA;
+    if (index >= (*soa)->_size) return CONTAINER_ERROR_INVALID_PARAM;
+
+    ByteSize last_ = --(*soa)->_size;
+    if (index == last_) return CONTAINER_SUCCESS;
+
+    for (ByteSize i = 0; i < (*soa)->_column_count; ++i) {
+        ByteSize data_size_ = (*soa)->_columns[i]._data_size;
+        BytePtr  stream_    = _container_soa_stream(*soa, i);
+
+        memcpy(stream_ + (data_size_ * index), stream_ + (data_size_ * last_), data_size_);
+    }
+
+    return CONTAINER_SUCCESS;
+}
+
+ContainerResult container_soa_reserve(SoA *soa, const ByteSize count) {
+    if (!soa) return CONTAINER_ERROR_INVALID_PARAM;
+    if (!(*soa)->_memory_size) return CONTAINER_ERROR_NOT_ALLOCATED;
+    if (count <= (*soa)->_capacity) return CONTAINER_SUCCESS;
+
+    return _container_soa_resize(soa, count);
+}
+
+ContainerResult container_soa_resize(SoA *soa, const ByteSize new_size, const Bool zeroed) {
+    if (!soa) return CONTAINER_ERROR_INVALID_PARAM;
+    if (!(*soa)->_memory_size) return CONTAINER_ERROR_NOT_ALLOCATED;
+
+    ContainerResult grow_ = _container_soa_grow(soa, new_size);
+    if (grow_ != CONTAINER_SUCCESS)
+        return grow_;
+
+    if (zeroed && (new_size > (*soa)->_size)) {
+        for (ByteSize i = 0; i < (*soa)->_column_count; ++i) {
+            ByteSize data_size_ = (*soa)->_columns[i]._data_size;
+            memset(_container_soa_stream(*soa, i) + (data_size_ * (*soa)->_size), 0, data_size_ * (new_size - (*soa)->_size));
+        }
+    }
+
+    (*soa)->_size = new_size;
+    return CONTAINER_SUCCESS;
+}
+
+ContainerResult container_soa_clear(SoA *soa) {
+    if (!soa) return CONTAINER_ERROR_INVALID_PARAM;
+    if (!(*soa)->_memory_size) return CONTAINER_ERROR_NOT_ALLOCATED;
+    if (!(*soa)->_size) return CONTAINER_ERROR_EMPTY_DATA;
+
+    (*soa)->_size = 0;
+    return CONTAINER_SUCCESS;
+}
+
+ContainerResult container_soa_column(SoA soa, const ByteSize column, SoAColumnView *out_view) {
+    if (!soa || !out_view || (column >= soa->_column_count)) return CONTAINER_ERROR_INVALID_PARAM;
+    if (!soa->_memory_size) return CONTAINER_ERROR_NOT_ALLOCATED;
+
+    out_view->_data      = _container_soa_stream(soa, column);
+    out_view->_data_size = soa->_columns[column]._data_size;
+    out_view->_size      = soa->_size;
+
+    return CONTAINER_SUCCESS;
+}
+
+ByteSize container_soa_size(SoA soa) {
+    return (!soa) ? 0 : soa->_size;
+}
+
+ByteSize container_soa_capacity(SoA soa) {
+    return (!soa) ? 0 : soa->_capacity;
+}
+
+ByteSize container_soa_column_count(SoA soa) {
+    return (!soa) ? 0 : soa->_column_count;
+}
+
+ByteSize container_soa_column_size(SoA soa, const ByteSize column) {
+    return (!soa || (column >= soa->_column_count)) ? 0 : soa->_columns[column]._data_size;
+}
+
+VoidPtr container_soa_column_data(SoA soa, const ByteSize column) {
+    return (!soa || (column >= soa->_column_count)) ? NULL : _container_soa_stream(soa, column);
+}
+
+VoidPtr container_soa_at_index(SoA soa, const ByteSize column, const ByteSize index) {
+    if (!soa || (column >= soa->_column_count) || (index >= soa->_size)) return NULL;
+
+    return _container_soa_stream(soa, column) + (soa->_columns[column]._data_size * index);
+}
+
+Bool container_soa_empty(SoA soa) {
+    return (!soa) ? true : (!soa->_size);
+}
@@ -0,0 +1,32 @@
+#pragma once
+
+#include "vytal/defines/core/containers.h"
+#include "vytal/defines/core/memory.h"
+#include "vytal/defines/shared.h"
+
+// a structure of arrays: every column (position, velocity, bounds, ...) is its own CONTAINER_SOA_ALIGNMENT aligned
+// stream inside one block, and all of them grow together; element i of a row is index i of every column.
+// growing may move the block, so column pointers and views are only good until the next push/reserve/resize
+VYTAL_API ContainerResult container_soa_construct(const ByteSize *column_sizes, const ByteSize column_count, SoA *out_new_soa);
+VYTAL_API ContainerResult container_soa_destruct(SoA soa);
+
+// values holds one pointer per column; a NULL values, or a NULL entry in it, zeroes those columns instead
+VYTAL_API ContainerResult container_soa_push(SoA *soa, const VoidPtr *values);
+VYTAL_API ContainerResult container_soa_pop(SoA *soa);
+VYTAL_API ContainerResult container_soa_swap_remove(SoA *soa, const ByteSize index);
+VYTAL_API ContainerResult container_soa_reserve(SoA *soa, const ByteSize count);
+VYTAL_API ContainerResult container_soa_resize(SoA *soa, const ByteSize new_size, const Bool zeroed);
+VYTAL_API ContainerResult container_soa_clear(SoA *soa);
+
+VYTAL_API ContainerResult container_soa_column(SoA soa, const ByteSize column, SoAColumnView *out_view);
+
+VYTAL_API ByteSize container_soa_size(SoA soa);
+VYTAL_API ByteSize container_soa_capacity(SoA soa);
+VYTAL_API ByteSize container_soa_column_count(SoA soa);
+VYTAL_API ByteSize container_soa_column_size(SoA soa, const ByteSize column);
+VYTAL_API VoidPtr  container_soa_column_data(SoA soa, const ByteSize column);
+VYTAL_API VoidPtr  container_soa_at_index(SoA soa, const ByteSize column, const ByteSize index);
+VYTAL_API Bool     container_soa_empty(SoA soa);
+
+// typed access to a column's stream, e.g. Vec4 *positions_ = VT_SOA_COLUMN(soa, Vec4, 0);
+#define VT_SOA_COLUMN(soa, T, column) ((T *)container_soa_column_data((soa), (column)))
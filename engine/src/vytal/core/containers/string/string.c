@@ -15,6 +15,10 @@
 
 #include "vytal/core/memory/zone/memory_zone.h"
 
+// strings are allocated on this alignment and the header is exactly one alignment step,
+// so the data starts on a 32-byte boundary and the AVX2 loops can use aligned loads
+#define CONTAINER_STRING_ALIGNMENT 32
+
 struct Container_String {
     Str      _data;
     ByteSize _size;
@@ -24,12 +28,14 @@ struct Container_String {
     ByteSize _memory_size;
 };
 
+_Static_assert(sizeof(struct Container_String) == CONTAINER_STRING_ALIGNMENT, "string data must start on an aligned boundary");
+
 VYTAL_INLINE ContainerResult _container_string_resize(String *str, const ByteSize new_capacity) {
     ByteSize new_alloc_size_ = sizeof(struct Container_String) + new_capacity;
 
     String old_str_ = *str;
     String new_str_ = NULL;
-    if (memory_zone_allocate("strings", new_alloc_size_, (VoidPtr *)&new_str_, NULL) != MEMORY_ZONE_SUCCESS)
+    if (memory_zone_allocate_aligned(MEMORY_ZONE_STRINGS, new_alloc_size_, CONTAINER_STRING_ALIGNMENT, (VoidPtr *)&new_str_, NULL) != MEMORY_ZONE_SUCCESS)
         return CONTAINER_ERROR_ALLOCATION_FAILED;
 
     new_str_->_size        = (*str)->_size;
@@ -39,7 +45,7 @@ VYTAL_INLINE ContainerResult _container_string_resize(String *str, const ByteSiz
 
     memcpy(new_str_->_data, (*str)->_data, (*str)->_size);
 
-    if (memory_zone_deallocate("strings", old_str_, old_str_->_memory_size) != MEMORY_ZONE_SUCCESS)
+    if (memory_zone_deallocate_aligned(MEMORY_ZONE_STRINGS, old_str_, old_str_->_memory_size, CONTAINER_STRING_ALIGNMENT) != MEMORY_ZONE_SUCCESS)
         return CONTAINER_ERROR_DEALLOCATION_FAILED;
 
     *str = new_str_;
@@ -76,7 +82,7 @@ ContainerResult container_string_construct(ConstStr content, String *out_new_str
     ByteSize capacity_   = VYTAL_APPLY_ALIGNMENT(content_length_ + 1, MEMORY_ALIGNMENT_SIZE) * CONTAINER_RESIZE_FACTOR;
     ByteSize alloc_size_ = sizeof(struct Container_String) + capacity_;
 
-    if (memory_zone_allocate("strings", alloc_size_, (VoidPtr *)out_new_str, NULL) != MEMORY_ZONE_SUCCESS)
+    if (memory_zone_allocate_aligned(MEMORY_ZONE_STRINGS, alloc_size_, CONTAINER_STRING_ALIGNMENT, (VoidPtr *)out_new_str, NULL) != MEMORY_ZONE_SUCCESS)
         return CONTAINER_ERROR_ALLOCATION_FAILED;
 
     (*out_new_str)->_size        = content_length_;
@@ -96,7 +102,7 @@ ContainerResult container_string_construct_char(const Char chr, String *out_new_
     ByteSize capacity_   = VYTAL_APPLY_ALIGNMENT(sizeof(Char) + 1, MEMORY_ALIGNMENT_SIZE) * CONTAINER_RESIZE_FACTOR;
     ByteSize alloc_size_ = sizeof(struct Container_String) + capacity_;
 
-    if (memory_zone_allocate("strings", alloc_size_, (VoidPtr *)out_new_str, NULL) != MEMORY_ZONE_SUCCESS)
+    if (memory_zone_allocate_aligned(MEMORY_ZONE_STRINGS, alloc_size_, CONTAINER_STRING_ALIGNMENT, (VoidPtr *)out_new_str, NULL) != MEMORY_ZONE_SUCCESS)
         return CONTAINER_ERROR_ALLOCATION_FAILED;
 
     (*out_new_str)->_size        = 0;
@@ -117,7 +123,7 @@ ContainerResult container_string_construct_chars(const Char chr, const ByteSize
     ByteSize capacity_       = VYTAL_APPLY_ALIGNMENT(content_length_ + 1, MEMORY_ALIGNMENT_SIZE) * CONTAINER_RESIZE_FACTOR;
     ByteSize alloc_size_     = sizeof(struct Container_String) + capacity_;
 
-    if (memory_zone_allocate("strings", alloc_size_, (VoidPtr *)out_new_str, NULL) != MEMORY_ZONE_SUCCESS)
+    if (memory_zone_allocate_aligned(MEMORY_ZONE_STRINGS, alloc_size_, CONTAINER_STRING_ALIGNMENT, (VoidPtr *)out_new_str, NULL) != MEMORY_ZONE_SUCCESS)
         return CONTAINER_ERROR_ALLOCATION_FAILED;
 
     (*out_new_str)->_size        = content_length_;
@@ -144,7 +150,7 @@ ContainerResult container_string_construct_formatted(String *out_new_str, ConstS
     ByteSize capacity_   = VYTAL_APPLY_ALIGNMENT(content_length_ + 1, MEMORY_ALIGNMENT_SIZE) * CONTAINER_RESIZE_FACTOR;
     ByteSize alloc_size_ = sizeof(struct Container_String) + capacity_;
 
-    if (memory_zone_allocate("strings", alloc_size_, (VoidPtr *)out_new_str, NULL) != MEMORY_ZONE_SUCCESS)
+    if (memory_zone_allocate_aligned(MEMORY_ZONE_STRINGS, alloc_size_, CONTAINER_STRING_ALIGNMENT, (VoidPtr *)out_new_str, NULL) != MEMORY_ZONE_SUCCESS)
         return CONTAINER_ERROR_ALLOCATION_FAILED;
 
     (*out_new_str)->_size        = content_length_;
@@ -167,7 +173,7 @@ ContainerResult container_string_destruct(String str) {
     if (!str) return CONTAINER_ERROR_INVALID_PARAM;
     if (!str->_data || !str->_memory_size) return CONTAINER_ERROR_NOT_ALLOCATED;
 
-    if (memory_zone_deallocate("strings", str, str->_memory_size) != MEMORY_ZONE_SUCCESS)
+    if (memory_zone_deallocate_aligned(MEMORY_ZONE_STRINGS, str, str->_memory_size, CONTAINER_STRING_ALIGNMENT) != MEMORY_ZONE_SUCCESS)
         return CONTAINER_ERROR_DEALLOCATION_FAILED;
 
     memset(str, 0, sizeof(struct Container_String));
@@ -250,12 +256,13 @@ ContainerResult container_string_append_formatted(String *str, ConstStr format,
         ByteSize capacity_   = VYTAL_APPLY_ALIGNMENT(content_length_ + 1, MEMORY_ALIGNMENT_SIZE) * CONTAINER_RESIZE_FACTOR;
         ByteSize alloc_size_ = sizeof(struct Container_String) + capacity_;
 
-        if (memory_zone_allocate("strings", alloc_size_, (VoidPtr *)str, NULL) != MEMORY_ZONE_SUCCESS)
+        if (memory_zone_allocate_aligned(MEMORY_ZONE_STRINGS, alloc_size_, CONTAINER_STRING_ALIGNMENT, (VoidPtr *)str, NULL) != MEMORY_ZONE_SUCCESS)
             return CONTAINER_ERROR_ALLOCATION_FAILED;
 
-        (*str)->_size     = 0;
-        (*str)->_capacity = capacity_;
-        (*str)->_data     = (Str)((UIntPtr)(*str) + sizeof(struct Container_String));
+        (*str)->_size        = 0;
+        (*str)->_capacity    = capacity_;
+        (*str)->_memory_size = alloc_size_;
+        (*str)->_data        = (Str)((UIntPtr)(*str) + sizeof(struct Container_String));
 
     } else {
         // handle container resizing
@@ -314,7 +321,7 @@ ContainerResult container_string_filter_char(String *str, const Char chr) {
     __m256i target256_ = _mm256_set1_epi8(chr);
 
     for (; read_ + 32 <= size_; read_ += 32) {
-        __m256i chunk_     = _mm256_loadu_si256((__m256i *)(data_ + read_));  // 32 bytes
+        __m256i chunk_     = _mm256_load_si256((__m256i *)(data_ + read_));   // 32 bytes
         __m256i mask_      = _mm256_cmpeq_epi8(chunk_, target256_);           // compare each chunk byte with chr
         Int32   mask_bits_ = _mm256_movemask_epi8(mask_);                     // return the bitmask for matching bytes
 
@@ -410,7 +417,7 @@ ContainerResult container_string_equals(String left, ConstStr right, const Bool
 
         // loop through 32 bytes
         while ((idx_ + 32 <= left->_size) && (idx_ + 32 <= right_length_)) {
-            chunk_left_  = _mm256_loadu_si256((__m256i *)(left->_data + idx_));
+            chunk_left_  = _mm256_load_si256((__m256i *)(left->_data + idx_));
             chunk_right_ = _mm256_loadu_si256((__m256i *)(right + idx_));
 
             // convert to lowercase
@@ -485,7 +492,7 @@ ContainerResult container_string_search(String str, ConstStr substr, const Bool
 
         // loop through 32 bytes
         while (idx_ + 32 <= str_length_) {
-            __m256i chunk_str_ = _mm256_loadu_si256((__m256i *)(str->_data + idx_));
+            __m256i chunk_str_ = _mm256_load_si256((__m256i *)(str->_data + idx_));
 
             // convert uppercase bytes to lowercase
             if (!case_sensitive) {
@@ -758,12 +765,13 @@ ContainerResult container_string_insert_formatted(String *str, const ByteSize in
         ByteSize capacity_   = VYTAL_APPLY_ALIGNMENT(content_length_ + 1, MEMORY_ALIGNMENT_SIZE) * CONTAINER_RESIZE_FACTOR;
         ByteSize alloc_size_ = sizeof(struct Container_String) + capacity_;
 
-        if (memory_zone_allocate("strings", alloc_size_, (VoidPtr *)str, NULL) != MEMORY_ZONE_SUCCESS)
+        if (memory_zone_allocate_aligned(MEMORY_ZONE_STRINGS, alloc_size_, CONTAINER_STRING_ALIGNMENT, (VoidPtr *)str, NULL) != MEMORY_ZONE_SUCCESS)
             return CONTAINER_ERROR_ALLOCATION_FAILED;
 
-        (*str)->_size     = 0;
-        (*str)->_capacity = capacity_;
-        (*str)->_data     = (Str)((UIntPtr)(*str) + sizeof(struct Container_String));
+        (*str)->_size        = 0;
+        (*str)->_capacity    = capacity_;
+        (*str)->_memory_size = alloc_size_;
+        (*str)->_data        = (Str)((UIntPtr)(*str) + sizeof(struct Container_String));
     } else {
         // handle container resizing
         if ((*str)->_size + (content_length_ + 1) >= (*str)->_capacity) {
@@ -834,7 +842,7 @@ ContainerResult container_string_to_lower(String *str) {
         // loop through 32 bytes
         while (idx_ + 32 <= (*str)->_size) {
             // load in the chunk
-            __m256i chunk_ = _mm256_loadu_si256((__m256i *)((*str)->_data + idx_));
+            __m256i chunk_ = _mm256_load_si256((__m256i *)((*str)->_data + idx_));
 
             // convert to lowercase for bytes that need to
             __m256i is_uppercase_ = _mm256_and_si256(
@@ -843,7 +851,7 @@ ContainerResult container_string_to_lower(String *str) {
             chunk_ = _mm256_or_si256(chunk_, _mm256_and_si256(is_uppercase_, lowercase_mask_));
 
             // save the chunk
-            _mm256_storeu_si256((__m256i *)((*str)->_data + idx_), chunk_);
+            _mm256_store_si256((__m256i *)((*str)->_data + idx_), chunk_);
             idx_ += 32;
         }
     }
@@ -899,7 +907,7 @@ ContainerResult container_string_to_upper(String *str) {
         // loop through 32 bytes
         while (idx_ + 32 <= (*str)->_size) {
             // load in the chunk
-            __m256i chunk_ = _mm256_loadu_si256((__m256i *)((*str)->_data + idx_));
+            __m256i chunk_ = _mm256_load_si256((__m256i *)((*str)->_data + idx_));
 
             // convert to uppercase for bytes that need to
             __m256i is_lowercase_ = _mm256_and_si256(
@@ -909,7 +917,7 @@ ContainerResult container_string_to_upper(String *str) {
                                      _mm256_andnot_si256(is_lowercase_, chunk_));
 
             // save the chunk
-            _mm256_storeu_si256((__m256i *)((*str)->_data + idx_), chunk_);
+            _mm256_store_si256((__m256i *)((*str)->_data + idx_), chunk_);
             idx_ += 32;
         }
     }
@@ -964,7 +972,7 @@ ContainerResult container_string_trim(String *str) {
 
         // trim leading spaces
         while (start_ + 32 <= end_) {
-            __m256i chunk_    = _mm256_loadu_si256((__m256i *)((*str)->_data + start_));
+            __m256i chunk_    = _mm256_load_si256((__m256i *)((*str)->_data + start_));
             __m256i is_space_ = _mm256_or_si256(
                 _mm256_cmpeq_epi8(chunk_, space_mask_),
                 _mm256_cmpeq_epi8(chunk_, tab_mask_));
@@ -1072,7 +1080,7 @@ ContainerResult container_string_trim_left(String *str) {
         __m256i tab_mask_   = _mm256_set1_epi8('\t');
 
         while (start_ + 32 <= end_) {
-            __m256i chunk_    = _mm256_loadu_si256((__m256i *)((*str)->_data + start_));
+            __m256i chunk_    = _mm256_load_si256((__m256i *)((*str)->_data + start_));
             __m256i is_space_ = _mm256_or_si256(
                 _mm256_cmpeq_epi8(chunk_, space_mask_),
                 _mm256_cmpeq_epi8(chunk_, tab_mask_));
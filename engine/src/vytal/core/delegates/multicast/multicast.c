@@ -4,6 +4,7 @@
 
 #include "vytal/core/containers/array/array.h"
 #include "vytal/core/containers/map/map.h"
+#include "vytal/core/hash/hash.h"
 #include "vytal/core/memory/zone/memory_zone.h"
 
 typedef struct Delegate_Multicast_State {
@@ -19,14 +20,14 @@ DelegateResult delegate_multicast_startup(void) {
     if (state) return DELEGATE_ERROR_ALREADY_INITIALIZED;
 
     ByteSize state_memory_size_ = 0;
-    if (memory_zone_allocate("delegates", sizeof(MulticastDelegateState), (VoidPtr *)&state, &state_memory_size_) != MEMORY_ZONE_SUCCESS)
+    if (memory_zone_allocate(MEMORY_ZONE_DELEGATES, sizeof(MulticastDelegateState), (VoidPtr *)&state, &state_memory_size_) != MEMORY_ZONE_SUCCESS)
         return DELEGATE_ERROR_ALLOCATION_FAILED;
     memset(state, 0, sizeof(MulticastDelegateState));
 
     // configure state members
     {
         if (container_map_construct(sizeof(MulticastDelegate), &state->_delegate_map) != CONTAINER_SUCCESS) {
-            if (memory_zone_deallocate("delegates", state, state->_memory_size) != MEMORY_ZONE_SUCCESS)
+            if (memory_zone_deallocate(MEMORY_ZONE_DELEGATES, state, state->_memory_size) != MEMORY_ZONE_SUCCESS)
                 return DELEGATE_ERROR_DEALLOCATION_FAILED;
 
             return DELEGATE_ERROR_ALLOCATION_FAILED;
@@ -36,7 +37,7 @@ DelegateResult delegate_multicast_startup(void) {
             if (container_map_destruct(state->_delegate_map) != CONTAINER_SUCCESS)
                 return DELEGATE_ERROR_DEALLOCATION_FAILED;
 
-            if (memory_zone_deallocate("delegates", state, state->_memory_size) != MEMORY_ZONE_SUCCESS)
+            if (memory_zone_deallocate(MEMORY_ZONE_DELEGATES, state, state->_memory_size) != MEMORY_ZONE_SUCCESS)
                 return DELEGATE_ERROR_DEALLOCATION_FAILED;
 
             return DELEGATE_ERROR_ALLOCATION_FAILED;
@@ -60,7 +61,7 @@ DelegateResult delegate_multicast_shutdown(void) {
             if (container_array_destruct(del_->_callbacks) != CONTAINER_SUCCESS)
                 return DELEGATE_ERROR_DEALLOCATION_FAILED;
 
-            if (memory_zone_deallocate("delegates", del_, sizeof(struct Delegate_Multicast_Handle)) != MEMORY_ZONE_SUCCESS)
+            if (memory_zone_deallocate(MEMORY_ZONE_DELEGATE_HANDLES, del_, sizeof(struct Delegate_Multicast_Handle)) != MEMORY_ZONE_SUCCESS)
                 return DELEGATE_ERROR_DEALLOCATION_FAILED;
         }
     }
@@ -71,7 +72,7 @@ DelegateResult delegate_multicast_shutdown(void) {
     if (container_map_destruct(state->_delegate_map) != CONTAINER_SUCCESS)
         return DELEGATE_ERROR_DEALLOCATION_FAILED;
 
-    if (memory_zone_deallocate("delegates", state, state->_memory_size) != MEMORY_ZONE_SUCCESS)
+    if (memory_zone_deallocate(MEMORY_ZONE_DELEGATES, state, state->_memory_size) != MEMORY_ZONE_SUCCESS)
         return DELEGATE_ERROR_DEALLOCATION_FAILED;
 
     state = NULL;
@@ -92,7 +93,7 @@ DelegateResult delegate_multicast_add(ConstStr delegate_id, VoidPtr listener, De
     // otherwise
     {
         // allocate the delegate
-        if (memory_zone_allocate("delegates", sizeof(struct Delegate_Multicast_Handle), (VoidPtr)&del_, NULL) != MEMORY_ZONE_SUCCESS)
+        if (memory_zone_allocate(MEMORY_ZONE_DELEGATE_HANDLES, sizeof(struct Delegate_Multicast_Handle), (VoidPtr)&del_, NULL) != MEMORY_ZONE_SUCCESS)
             return DELEGATE_ERROR_ALLOCATION_FAILED;
 
         // bind the listener
@@ -100,7 +101,7 @@ DelegateResult delegate_multicast_add(ConstStr delegate_id, VoidPtr listener, De
 
         // construct a list of callbacks
         if (container_array_construct(sizeof(DelegateFunction), &del_->_callbacks) != CONTAINER_SUCCESS) {
-            if (memory_zone_deallocate("delegates", del_, sizeof(struct Delegate_Multicast_Handle)) != MEMORY_ZONE_SUCCESS)
+            if (memory_zone_deallocate(MEMORY_ZONE_DELEGATE_HANDLES, del_, sizeof(struct Delegate_Multicast_Handle)) != MEMORY_ZONE_SUCCESS)
                 return DELEGATE_ERROR_DEALLOCATION_FAILED;
 
             return DELEGATE_ERROR_ALLOCATION_FAILED;
@@ -111,7 +112,7 @@ DelegateResult delegate_multicast_add(ConstStr delegate_id, VoidPtr listener, De
             if (container_array_destruct(del_->_callbacks) != CONTAINER_SUCCESS)
                 return DELEGATE_ERROR_DEALLOCATION_FAILED;
 
-            if (memory_zone_deallocate("delegates", del_, sizeof(struct Delegate_Multicast_Handle)) != MEMORY_ZONE_SUCCESS)
+            if (memory_zone_deallocate(MEMORY_ZONE_DELEGATE_HANDLES, del_, sizeof(struct Delegate_Multicast_Handle)) != MEMORY_ZONE_SUCCESS)
                 return DELEGATE_ERROR_DEALLOCATION_FAILED;
 
             return DELEGATE_ERROR_DATA_INSERT_FAILED;
@@ -122,7 +123,7 @@ DelegateResult delegate_multicast_add(ConstStr delegate_id, VoidPtr listener, De
             if (container_array_destruct(del_->_callbacks) != CONTAINER_SUCCESS)
                 return DELEGATE_ERROR_DEALLOCATION_FAILED;
 
-            if (memory_zone_deallocate("delegates", del_, sizeof(struct Delegate_Multicast_Handle)) != MEMORY_ZONE_SUCCESS)
+            if (memory_zone_deallocate(MEMORY_ZONE_DELEGATE_HANDLES, del_, sizeof(struct Delegate_Multicast_Handle)) != MEMORY_ZONE_SUCCESS)
                 return DELEGATE_ERROR_DEALLOCATION_FAILED;
 
             return DELEGATE_ERROR_DATA_INSERT_FAILED;
@@ -172,7 +173,7 @@ DelegateResult delegate_multicast_remove(ConstStr delegate_id, DelegateFunction
         if (container_array_remove(&state->_active_delegates, del_, false) != CONTAINER_SUCCESS)
             return DELEGATE_ERROR_DATA_REMOVE_FAILED;
 
-        if (memory_zone_deallocate("delegates", del_, sizeof(struct Delegate_Multicast_Handle)) != MEMORY_ZONE_SUCCESS)
+        if (memory_zone_deallocate(MEMORY_ZONE_DELEGATE_HANDLES, del_, sizeof(struct Delegate_Multicast_Handle)) != MEMORY_ZONE_SUCCESS)
             return DELEGATE_ERROR_DEALLOCATION_FAILED;
 
         del_ = NULL;
@@ -182,12 +183,16 @@ DelegateResult delegate_multicast_remove(ConstStr delegate_id, DelegateFunction
 }
 
 DelegateResult delegate_multicast_invoke(ConstStr delegate_id, VoidPtr sender, VoidPtr data) {
+    return delegate_multicast_invoke_hashed(hash_str(delegate_id, CONTAINER_MAP_HASH_MODE), delegate_id, sender, data);
+}
+
+DelegateResult delegate_multicast_invoke_hashed(const HashedInt delegate_hash, ConstStr delegate_id, VoidPtr sender, VoidPtr data) {
     if (!state) return DELEGATE_ERROR_NOT_INITIALIZED;
     if (!state->_initialized) return DELEGATE_ERROR_NOT_INITIALIZED;
     if (!delegate_id || !data) return DELEGATE_ERROR_INVALID_PARAM;
 
     MulticastDelegate del_ = NULL;
-    if (container_map_search(state->_delegate_map, delegate_id, (VoidPtr *)&del_) != CONTAINER_SUCCESS)
+    if (container_map_search_hashed(state->_delegate_map, delegate_hash, delegate_id, (VoidPtr *)&del_) != CONTAINER_SUCCESS)
         return DELEGATE_ERROR_DATA_SEARCH_FAILED;
 
     // if delegate is not found
@@ -4,6 +4,7 @@
 
 #include "vytal/core/containers/array/array.h"
 #include "vytal/core/containers/map/map.h"
+#include "vytal/core/hash/hash.h"
 #include "vytal/core/memory/zone/memory_zone.h"
 
 typedef struct Delegate_Unicast_State {
@@ -18,14 +19,14 @@ DelegateResult delegate_unicast_startup(void) {
     if (state) return DELEGATE_ERROR_ALREADY_INITIALIZED;
 
     ByteSize state_memory_size_ = 0;
-    if (memory_zone_allocate("delegates", sizeof(UnicastDelegateState), (VoidPtr)&state, &state_memory_size_) != MEMORY_ZONE_SUCCESS)
+    if (memory_zone_allocate(MEMORY_ZONE_DELEGATES, sizeof(UnicastDelegateState), (VoidPtr)&state, &state_memory_size_) != MEMORY_ZONE_SUCCESS)
         return DELEGATE_ERROR_ALLOCATION_FAILED;
     memset(state, 0, sizeof(UnicastDelegateState));
 
     // configure state members
     {
         if (container_map_construct(sizeof(UnicastDelegate), &state->_delegate_map) != CONTAINER_SUCCESS) {
-            if (memory_zone_deallocate("delegates", state, state->_memory_size) != MEMORY_ZONE_SUCCESS)
+            if (memory_zone_deallocate(MEMORY_ZONE_DELEGATES, state, state->_memory_size) != MEMORY_ZONE_SUCCESS)
                 return DELEGATE_ERROR_DEALLOCATION_FAILED;
 
             return DELEGATE_ERROR_ALLOCATION_FAILED;
@@ -45,7 +46,7 @@ DelegateResult delegate_unicast_shutdown(void) {
     if (container_map_destruct(state->_delegate_map) != CONTAINER_SUCCESS)
         return DELEGATE_ERROR_DEALLOCATION_FAILED;
 
-    if (memory_zone_deallocate("delegates", state, state->_memory_size) != MEMORY_ZONE_SUCCESS)
+    if (memory_zone_deallocate(MEMORY_ZONE_DELEGATES, state, state->_memory_size) != MEMORY_ZONE_SUCCESS)
         return DELEGATE_ERROR_DEALLOCATION_FAILED;
 
     state = NULL;
@@ -68,7 +69,7 @@ DelegateResult delegate_unicast_bind(ConstStr delegate_id, VoidPtr listener, Del
         return DELEGATE_SUCCESS;
 
     // allocate delegate
-    if (memory_zone_allocate("delegates", sizeof(struct Delegate_Unicast_Handle), (VoidPtr *)&del_, NULL) != MEMORY_ZONE_SUCCESS) return DELEGATE_ERROR_ALLOCATION_FAILED;
+    if (memory_zone_allocate(MEMORY_ZONE_DELEGATE_HANDLES, sizeof(struct Delegate_Unicast_Handle), (VoidPtr *)&del_, NULL) != MEMORY_ZONE_SUCCESS) return DELEGATE_ERROR_ALLOCATION_FAILED;
 
     // configure delegate
     {
@@ -78,7 +79,7 @@ DelegateResult delegate_unicast_bind(ConstStr delegate_id, VoidPtr listener, Del
 
     // register delegate
     if (container_map_insert(&state->_delegate_map, delegate_id, (VoidPtr)&del_) != CONTAINER_SUCCESS) {
-        if (memory_zone_deallocate("delegates", del_, sizeof(struct Delegate_Unicast_Handle)) != MEMORY_ZONE_SUCCESS)
+        if (memory_zone_deallocate(MEMORY_ZONE_DELEGATE_HANDLES, del_, sizeof(struct Delegate_Unicast_Handle)) != MEMORY_ZONE_SUCCESS)
             return DELEGATE_ERROR_DEALLOCATION_FAILED;
 
         return DELEGATE_ERROR_DATA_INSERT_FAILED;
@@ -99,7 +100,7 @@ DelegateResult delegate_unicast_unbind(ConstStr delegate_id) {
             return DELEGATE_ERROR_DATA_SEARCH_FAILED;
         if (!del_) return DELEGATE_ERROR_DATA_NOT_EXIST;
 
-        if (memory_zone_deallocate("delegates", del_, sizeof(struct Delegate_Unicast_Handle)) != MEMORY_ZONE_SUCCESS)
+        if (memory_zone_deallocate(MEMORY_ZONE_DELEGATE_HANDLES, del_, sizeof(struct Delegate_Unicast_Handle)) != MEMORY_ZONE_SUCCESS)
             return DELEGATE_ERROR_DEALLOCATION_FAILED;
     }
 
@@ -125,12 +126,16 @@ DelegateResult delegate_unicast_set_callback(ConstStr delegate_id, DelegateFunct
 }
 
 DelegateResult delegate_unicast_invoke(ConstStr delegate_id, VoidPtr sender, VoidPtr data) {
+    return delegate_unicast_invoke_hashed(hash_str(delegate_id, CONTAINER_MAP_HASH_MODE), delegate_id, sender, data);
+}
+
+DelegateResult delegate_unicast_invoke_hashed(const HashedInt delegate_hash, ConstStr delegate_id, VoidPtr sender, VoidPtr data) {
     if (!state) return DELEGATE_ERROR_NOT_INITIALIZED;
     if (!state->_initialized) return DELEGATE_ERROR_NOT_INITIALIZED;
     if (!delegate_id || !data) return DELEGATE_ERROR_INVALID_PARAM;
 
     UnicastDelegate del_ = NULL;
-    if (container_map_search(state->_delegate_map, delegate_id, (VoidPtr *)&del_) != CONTAINER_SUCCESS)
+    if (container_map_search_hashed(state->_delegate_map, delegate_hash, delegate_id, (VoidPtr *)&del_) != CONTAINER_SUCCESS)
         return DELEGATE_ERROR_DATA_SEARCH_FAILED;
     if (!del_) return DELEGATE_ERROR_DATA_NOT_EXIST;
 
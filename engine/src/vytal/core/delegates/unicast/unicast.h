@@ -1,6 +1,7 @@
 #pragma once
 
 #include "vytal/defines/core/delegates.h"
+#include "vytal/defines/core/hash.h"
 #include "vytal/defines/shared.h"
 
 VYTAL_API DelegateResult delegate_unicast_startup(void);
@@ -10,3 +11,4 @@ VYTAL_API DelegateResult delegate_unicast_bind(ConstStr delegate_id, VoidPtr lis
 VYTAL_API DelegateResult delegate_unicast_unbind(ConstStr delegate_id);
 VYTAL_API DelegateResult delegate_unicast_set_callback(ConstStr delegate_id, DelegateFunction callback);
 VYTAL_API DelegateResult delegate_unicast_invoke(ConstStr delegate_id, VoidPtr sender, VoidPtr data);
+VYTAL_API DelegateResult delegate_unicast_invoke_hashed(const HashedInt delegate_hash, ConstStr delegate_id, VoidPtr sender, VoidPtr data);
@@ -119,7 +119,7 @@ EngineResult _engine_core_startup(void) {
     // allocate application state and configure its members
     {
         ByteSize         allocated_size_  = 0;
-        MemoryZoneResult allocate_engine_ = memory_zone_allocate("core", sizeof(EngineState), (VoidPtr *)&state, &allocated_size_);
+        MemoryZoneResult allocate_engine_ = memory_zone_allocate(MEMORY_ZONE_CORE, sizeof(EngineState), (VoidPtr *)&state, &allocated_size_);
         if (allocate_engine_ != MEMORY_ZONE_SUCCESS)
             return ENGINE_ERROR_PRECONSTRUCT_MEMORY_MANAGER_STARTUP_FAILED;
         memset(state, 0, sizeof(EngineState));
@@ -134,7 +134,7 @@ EngineResult _engine_core_startup(void) {
 EngineResult _engine_core_shutdown(void) {
     // deallocate application state
     {
-        MemoryManagerResult deallocate_engine_ = memory_zone_deallocate("core", state, state->_memory_size);
+        MemoryManagerResult deallocate_engine_ = memory_zone_deallocate(MEMORY_ZONE_CORE, state, state->_memory_size);
         if (deallocate_engine_ != MEMORY_MANAGER_SUCCESS)
             return ENGINE_ERROR_DESTRUCT_DEALLOCATION_FAILED;
 
@@ -209,6 +209,10 @@ EngineResult engine_update(void) {
             return ENGINE_ERROR_UPDATE_WINDOW_MODULE_UPDATE_FAILED;
     }
 
+    // frame arenas: drop the previous frame's transient data
+    if (memory_manager_advance_frame() != MEMORY_MANAGER_SUCCESS)
+        return ENGINE_ERROR_UPDATE_MEMORY_ADVANCE_FRAME_FAILED;
+
     return ENGINE_SUCCESS;
 }
 
@@ -35,6 +35,7 @@ typedef enum Engine_Result {
     // update
     ENGINE_ERROR_UPDATE_INPUT_MODULE_UPDATE_FAILED  = -300,
     ENGINE_ERROR_UPDATE_WINDOW_MODULE_UPDATE_FAILED = -301,
+    ENGINE_ERROR_UPDATE_MEMORY_ADVANCE_FRAME_FAILED = -302,
 
     // destruct
     ENGINE_ERROR_DESTRUCT_DEALLOCATION_FAILED = -400,
@@ -0,0 +1,24 @@
+#include "fnv1a64.h"
+
+HashedInt hash_fnv1a64_buffer(const VoidPtr buffer, const ByteSize size) {
+    const UInt8 *pbyte_ = (const UInt8 *)buffer;
+    HashedInt    hash_  = HASH_FNV1A64_OFFSET;
+
+    for (ByteSize i = 0; i < size; ++i) {
+        hash_ ^= pbyte_[i];
+        hash_ *= HASH_FNV1A64_PRIME;
+    }
+
+    return hash_;
+}
+
+HashedInt hash_fnv1a64_str(ConstStr str) {
+    HashedInt hash_ = HASH_FNV1A64_OFFSET;
+
+    for (; *str; ++str) {
+        hash_ ^= (UInt8)*str;
+        hash_ *= HASH_FNV1A64_PRIME;
+    }
+
+    return hash_;
+}
@@ -0,0 +1,7 @@
+#pragma once
+
+#include "vytal/defines/core/hash.h"
+#include "vytal/defines/shared.h"
+
+VYTAL_API HashedInt hash_fnv1a64_buffer(const VoidPtr buffer, const ByteSize size);
+VYTAL_API HashedInt hash_fnv1a64_str(ConstStr str);
@@ -2,6 +2,7 @@
 
 #include <string.h>
 
+#include "vytal/core/hash/fnv1a64/fnv1a64.h"
 #include "vytal/core/hash/xxhash64/xxhash64.h"
 
 #define INVALID_HASH (0xffffffffu)
@@ -13,6 +14,9 @@ HashedInt hash_buffer(const VoidPtr buffer, const ByteSize size, const HashMode
         case HASH_MODE_XX64:
             return hash_xx64_buffer(buffer, size);
 
+        case HASH_MODE_FNV1A64:
+            return hash_fnv1a64_buffer(buffer, size);
+
         default:
             return INVALID_HASH;
     }
@@ -25,6 +29,9 @@ HashedInt hash_str(ConstStr str, const HashMode mode) {
         case HASH_MODE_XX64:
             return hash_xx64_buffer(str, strlen(str));
 
+        case HASH_MODE_FNV1A64:
+            return hash_fnv1a64_str(str);
+
         default:
             return INVALID_HASH;
     }
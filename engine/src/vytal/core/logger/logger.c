@@ -9,6 +9,7 @@
 #include "vytal/core/containers/map/map.h"
 #include "vytal/core/containers/string/string.h"
 #include "vytal/core/hal/clock/wall/wall.h"
+#include "vytal/core/hash/hash.h"
 #include "vytal/core/helpers/parse/parse.h"
 #include "vytal/core/misc/console/console.h"
 
@@ -150,12 +151,10 @@ LoggerResult logger_shutdown(void) {
     if (!state) return LOGGER_ERROR_STATE_NOT_INITIALIZED;
     if (!state->_initialized) return LOGGER_ERROR_STATE_NOT_INITIALIZED;
 
-    // go through very logger in the map and deallocate its members
-    ByteSize capacity_ = container_map_capacity(state->_logger_map);
-    for (ByteSize i = 0; i < capacity_; ++i) {
-        Logger logger_ = container_map_at_index(state->_logger_map, i);
-
-        if (!logger_->_name) continue;
+    // go through every logger in the map and deallocate its members
+    MapIterator it_;
+    for (Bool live_ = container_map_iter_begin(state->_logger_map, &it_); live_; live_ = container_map_iter_next(state->_logger_map, &it_)) {
+        Logger logger_ = it_._data;
 
         // destruct the name
         if (container_string_destruct(logger_->_name) != CONTAINER_SUCCESS)
@@ -165,8 +164,6 @@ LoggerResult logger_shutdown(void) {
         if (logger_->_file._stream && logger_->_file._active)
             if (platform_filesystem_close_file(&logger_->_file) != FILE_SUCCESS)
                 return LOGGER_ERROR_FILE_CLOSE_FAILED;
-
-        memset(logger_, 0, sizeof(struct Logger_Handle));
     }
 
     // destruct the logger map
@@ -179,25 +176,30 @@ LoggerResult logger_shutdown(void) {
     return LOGGER_SUCCESS;
 }
 
-LoggerResult logger_print(
+static LoggerResult _logger_vprint(
+    HashedInt       logger_hash,
     ConstStr        logger_id,
     LoggerVerbosity verbosity,
     ConstStr        at_file,
     Int32           at_line,
     ConstStr        at_function,
     ConstStr        message,
-    ...) {
+    VaList          args) {
     if (!state) return LOGGER_ERROR_STATE_NOT_INITIALIZED;
     if (!logger_id || !message) return LOGGER_ERROR_INVALID_PARAM;
 
     // extract filename from filepath
     ConstStr filename_ = EXTRACT_FILENAME(at_file);
 
-    Logger logger_;
-    if (container_map_search(state->_logger_map, logger_id, (VoidPtr *)&logger_) != CONTAINER_SUCCESS) {
+    // the map holds the handles by value
+    struct Logger_Handle handle_ = {0};
+    if (container_map_search_hashed(state->_logger_map, logger_hash, logger_id, (VoidPtr *)&handle_) != CONTAINER_SUCCESS) {
         free(state);
         return LOGGER_ERROR_INVALID_LOGGER_NAME;
     }
+    if (!handle_._name) return LOGGER_ERROR_INVALID_LOGGER_NAME;
+
+    Logger logger_ = &handle_;
 
     ConstStr verbosity_values_[] = {"FATAL", "ERROR", "WARNING", "INFO", "VERBOSE"};
     if ((verbosity < LOG_VERBOSITY_FATAL) || (verbosity > LOG_VERBOSITY_VERBOSE))
@@ -212,11 +214,8 @@ LoggerResult logger_print(
     strftime(log_time_, sizeof(log_time_), "%F %T", &(clock_._time_info));
 
     // format log message
-    VaList va_list_;
-    Char   log_content_[LINE_BUFFER_MAX_SIZE] = {'\0'};
-    va_start(va_list_, message);
-    vsnprintf(log_content_, sizeof(log_content_), message, va_list_);
-    va_end(va_list_);
+    Char log_content_[LINE_BUFFER_MAX_SIZE] = {'\0'};
+    vsnprintf(log_content_, sizeof(log_content_), message, args);
 
     // ideal total width for most modern terminals = 120
 
@@ -336,3 +335,36 @@ LoggerResult logger_print(
     // verbose messages tend not to be written to output file
     return (verbosity == LOG_VERBOSITY_VERBOSE) ? CONTAINER_SUCCESS : _logger_write_to_file(&(logger_->_file), log_file_entry_);
 }
+
+LoggerResult logger_print(
+    ConstStr        logger_id,
+    LoggerVerbosity verbosity,
+    ConstStr        at_file,
+    Int32           at_line,
+    ConstStr        at_function,
+    ConstStr        message,
+    ...) {
+    VaList va_list_;
+    va_start(va_list_, message);
+    LoggerResult result_ = _logger_vprint(hash_str(logger_id, CONTAINER_MAP_HASH_MODE), logger_id, verbosity, at_file, at_line, at_function, message, va_list_);
+    va_end(va_list_);
+
+    return result_;
+}
+
+LoggerResult logger_print_hashed(
+    HashedInt       logger_hash,
+    ConstStr        logger_id,
+    LoggerVerbosity verbosity,
+    ConstStr        at_file,
+    Int32           at_line,
+    ConstStr        at_function,
+    ConstStr        message,
+    ...) {
+    VaList va_list_;
+    va_start(va_list_, message);
+    LoggerResult result_ = _logger_vprint(logger_hash, logger_id, verbosity, at_file, at_line, at_function, message, va_list_);
+    va_end(va_list_);
+
+    return result_;
+}
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "vytal/core/platform/filesystem/filesystem.h"
+#include "vytal/defines/core/hash.h"
 #include "vytal/defines/core/logger.h"
 #include "vytal/defines/shared.h"
 
@@ -16,20 +17,31 @@ VYTAL_API LoggerResult logger_print(
     ConstStr        message,
     ...);
 
+// same as logger_print(), with the id hashed up front (see HASH_LITERAL)
+VYTAL_API LoggerResult logger_print_hashed(
+    HashedInt       logger_hash,
+    ConstStr        logger_id,
+    LoggerVerbosity verbosity,
+    ConstStr        at_file,
+    Int32           at_line,
+    ConstStr        at_function,
+    ConstStr        message,
+    ...);
+
 #define VYTAL_LOG_FATAL(message, ...) \
-    logger_print("VYTAL_ENGINE", LOG_VERBOSITY_FATAL, __FILE__, __LINE__, __func__, message, ##__VA_ARGS__)
+    logger_print_hashed(HASH_LITERAL_ONCE("VYTAL_ENGINE"), "VYTAL_ENGINE", LOG_VERBOSITY_FATAL, __FILE__, __LINE__, __func__, message, ##__VA_ARGS__)
 
 #define VYTAL_LOG_ERROR(message, ...) \
-    logger_print("VYTAL_ENGINE", LOG_VERBOSITY_ERROR, __FILE__, __LINE__, __func__, message, ##__VA_ARGS__)
+    logger_print_hashed(HASH_LITERAL_ONCE("VYTAL_ENGINE"), "VYTAL_ENGINE", LOG_VERBOSITY_ERROR, __FILE__, __LINE__, __func__, message, ##__VA_ARGS__)
 
 #define VYTAL_LOG_WARNING(message, ...) \
-    logger_print("VYTAL_ENGINE", LOG_VERBOSITY_WARNING, __FILE__, __LINE__, __func__, message, ##__VA_ARGS__)
+    logger_print_hashed(HASH_LITERAL_ONCE("VYTAL_ENGINE"), "VYTAL_ENGINE", LOG_VERBOSITY_WARNING, __FILE__, __LINE__, __func__, message, ##__VA_ARGS__)
 
 #define VYTAL_LOG_INFO(message, ...) \
-    logger_print("VYTAL_ENGINE", LOG_VERBOSITY_INFO, __FILE__, __LINE__, __func__, message, ##__VA_ARGS__)
+    logger_print_hashed(HASH_LITERAL_ONCE("VYTAL_ENGINE"), "VYTAL_ENGINE", LOG_VERBOSITY_INFO, __FILE__, __LINE__, __func__, message, ##__VA_ARGS__)
 
 #define VYTAL_LOG_VERBOSE(message, ...) \
-    logger_print("VYTAL_ENGINE", LOG_VERBOSITY_VERBOSE, __FILE__, __LINE__, __func__, message, ##__VA_ARGS__)
+    logger_print_hashed(HASH_LITERAL_ONCE("VYTAL_ENGINE"), "VYTAL_ENGINE", LOG_VERBOSITY_VERBOSE, __FILE__, __LINE__, __func__, message, ##__VA_ARGS__)
 
 #define LOGGER_LOG_FATAL(logger_id, message, ...) \
     logger_print(logger_id, LOG_VERBOSITY_FATAL, __FILE__, __LINE__, __func__, message, ##__VA_ARGS__)
@@ -1,23 +1,212 @@
 #include "memory_manager.h"
 
 #include <ctype.h>
+#include <stdint.h>
+#include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 
 #include "vytal/core/helpers/parse/parse.h"
+#include "vytal/core/memory/zone/allocators/pool/allocator_pool.h"
 #include "vytal/core/memory/zone/memory_zone.h"
 #include "vytal/core/platform/filesystem/filesystem.h"
+#include "vytal/core/platform/memory/memory.h"
 
 static MemoryManager *manager = NULL;
 
+// indexed by MemoryZoneHandle; keys declared in [memory_zones]
+static ConstStr builtin_zone_names[MEMORY_ZONE_BUILTIN_COUNT] = {
+    "core",
+    "modules",
+    "containers",
+    "strings",
+    "delegates",
+    "input",
+    "platform",
+    "assets",
+    "renderer",
+    "frame",
+    "scratch",
+    "delegate_handles",
+};
+
+// declared with these when a config predates the zone, so callers can rely on every built-in zone existing
+static ConstStr builtin_zone_defaults[MEMORY_ZONE_BUILTIN_COUNT] = {
+    [MEMORY_ZONE_SCRATCH]          = "4MB -> stack",
+    [MEMORY_ZONE_DELEGATE_HANDLES] = "512 x 16",
+};
+
+ByteSize _memory_manager_builtin_zone_slot(ConstStr zone_name) {
+    for (ByteSize i = 0; i < MEMORY_ZONE_BUILTIN_COUNT; ++i)
+        if (!strcmp(builtin_zone_names[i], zone_name)) return i;
+
+    return MEMORY_ZONE_BUILTIN_COUNT;
+}
+
+// "<count> x <slot size>" declares a pool zone instead of a capacity
+Bool _memory_manager_parse_pool_layout(ConstStr value, ByteSize *out_slot_count, ByteSize *out_slot_size) {
+    ByteSize slot_count_ = 0;
+    ByteSize slot_size_  = 0;
+
+    if (sscanf(value, "%zu x %zu", &slot_count_, &slot_size_) != 2) return false;
+    if (!slot_count_ || !slot_size_ || (slot_count_ > UINT32_MAX)) return false;
+
+    *out_slot_count = slot_count_;
+    *out_slot_size  = VYTAL_APPLY_ALIGNMENT(slot_size_, MEMORY_ALIGNMENT_SIZE);
+    return true;
+}
+
+// splits "<capacity> -> <options>" into the zone type, flags and growth cap
+void _memory_manager_parse_zone_options(Str value, MemoryZoneType *out_type, MemoryZoneFlag *out_flags, ByteSize *out_max_capacity) {
+    *out_type         = MEMORY_ZONE_TYPE_GENERAL;
+    *out_flags        = MEMORY_ZONE_FLAG_NONE;
+    *out_max_capacity = 0;
+
+    Str psep_options_ = strstr(value, "->");
+    if (psep_options_) *psep_options_ = '\0';
+
+    ByteSize slot_count_ = 0;
+    ByteSize slot_size_  = 0;
+    if (_memory_manager_parse_pool_layout(value, &slot_count_, &slot_size_))
+        *out_type = MEMORY_ZONE_TYPE_POOL;
+
+    if (!psep_options_) return;
+
+    for (Str option_ = strtok(psep_options_ + 2, ", \t\""); option_; option_ = strtok(NULL, ", \t\"")) {
+        if (!strcmp(option_, "frame_arena") && (*out_type != MEMORY_ZONE_TYPE_POOL))
+            *out_type = MEMORY_ZONE_TYPE_FRAME_ARENA;
+
+        else if (!strcmp(option_, "stack") && (*out_type != MEMORY_ZONE_TYPE_POOL))
+            *out_type = MEMORY_ZONE_TYPE_STACK;
+
+        else if (!strcmp(option_, "concurrent"))
+            VYTAL_BITFLAG_SET(*out_flags, MEMORY_ZONE_FLAG_CONCURRENT);
+
+        else if (!strcmp(option_, "coalesce"))
+            VYTAL_BITFLAG_SET(*out_flags, MEMORY_ZONE_FLAG_COALESCE);
+
+        else if (!strcmp(option_, "reserve"))
+            VYTAL_BITFLAG_SET(*out_flags, MEMORY_ZONE_FLAG_RESERVE);
+
+        else if (!strcmp(option_, "hugepages"))
+            VYTAL_BITFLAG_SET(*out_flags, MEMORY_ZONE_FLAG_RESERVE | MEMORY_ZONE_FLAG_HUGE_PAGES);
+
+        // "grow" is unbounded, "grow:<size>" caps the zone's total capacity
+        else if (!strncmp(option_, "grow", 4) && (!option_[4] || option_[4] == ':')) {
+            VYTAL_BITFLAG_SET(*out_flags, MEMORY_ZONE_FLAG_GROWABLE);
+            if (option_[4] == ':') *out_max_capacity = parse_memory_size(option_ + 5);
+        }
+    }
+
+    // coalescing walks neighbouring blocks, which thread caches would hold on to
+    // (and arenas have no blocks to walk at all)
+    if (VYTAL_BITFLAG_IF_SET(*out_flags, MEMORY_ZONE_FLAG_CONCURRENT) || (*out_type != MEMORY_ZONE_TYPE_GENERAL))
+        VYTAL_BITFLAG_CLEAR(*out_flags, MEMORY_ZONE_FLAG_COALESCE);
+
+    // stack markers and pool slot bookkeeping are single-threaded
+    if ((*out_type == MEMORY_ZONE_TYPE_STACK) || (*out_type == MEMORY_ZONE_TYPE_POOL))
+        VYTAL_BITFLAG_CLEAR(*out_flags, MEMORY_ZONE_FLAG_CONCURRENT);
+
+    // chunks only feed size classes; boundary tags, markers and slot indices all assume one region
+    if (VYTAL_BITFLAG_IF_SET(*out_flags, MEMORY_ZONE_FLAG_COALESCE) || (*out_type != MEMORY_ZONE_TYPE_GENERAL))
+        VYTAL_BITFLAG_CLEAR(*out_flags, MEMORY_ZONE_FLAG_GROWABLE);
+}
+
+// zone memory (unless reserved on its own), followed by its size classes and
+// (if concurrent) its thread caches, or by its slot bookkeeping for pools
+ByteSize _memory_manager_zone_footprint(const ByteSize capacity, const MemoryZoneType type, const MemoryZoneFlag flags, const ByteSize slot_count) {
+    ByteSize payload_ = VYTAL_BITFLAG_IF_SET(flags, MEMORY_ZONE_FLAG_RESERVE) ? 0 : capacity;
+
+    if (type == MEMORY_ZONE_TYPE_POOL) return payload_ + memory_zone_pool_compute_metadata_size(slot_count);
+
+    // arenas and stacks are bare bump regions
+    if (type != MEMORY_ZONE_TYPE_GENERAL) return payload_;
+
+    ByteSize num_sizeclasses_ = 0;
+    memory_zone_compute_size_classes(&num_sizeclasses_, NULL, capacity);
+
+    ByteSize footprint_ = payload_ + (sizeof(MemoryZoneSizeClass) * num_sizeclasses_);
+    if (VYTAL_BITFLAG_IF_SET(flags, MEMORY_ZONE_FLAG_CONCURRENT))
+        footprint_ += memory_zone_compute_thread_caches_size(num_sizeclasses_);
+
+    return VYTAL_APPLY_ALIGNMENT(footprint_, MEMORY_ALIGNMENT_SIZE);
+}
+
+// footprint of a zone declared as value (which the option parsing cuts up)
+ByteSize _memory_manager_declared_footprint(Str value) {
+    MemoryZoneType type_;
+    MemoryZoneFlag flags_;
+    ByteSize       max_capacity_;
+    _memory_manager_parse_zone_options(value, &type_, &flags_, &max_capacity_);
+
+    ByteSize slot_count_ = 0;
+    ByteSize slot_size_  = 0;
+    ByteSize capacity_   = 0;
+
+    if (type_ == MEMORY_ZONE_TYPE_POOL) {
+        _memory_manager_parse_pool_layout(value, &slot_count_, &slot_size_);
+        capacity_ = slot_count_ * slot_size_;
+    } else
+        capacity_ = VYTAL_APPLY_ALIGNMENT(parse_memory_size(value), MEMORY_ALIGNMENT_SIZE);
+
+    return _memory_manager_zone_footprint(capacity_, type_, flags_, slot_count_);
+}
+
+// lays the zone out at start_addr and moves start_addr past its footprint
+MemoryManagerResult _memory_manager_construct_zone(MemoryZone *zone, ConstStr name, Str value, UIntPtr *start_addr) {
+    zone->_name = strdup(name);
+    _memory_manager_parse_zone_options(value, &zone->_type, &zone->_flags, &zone->_max_capacity);
+
+    ByteSize slot_count_ = 0;
+    ByteSize slot_size_  = 0;
+    ByteSize capacity_   = 0;
+
+    if (zone->_type == MEMORY_ZONE_TYPE_POOL) {
+        _memory_manager_parse_pool_layout(value, &slot_count_, &slot_size_);
+        capacity_ = slot_count_ * slot_size_;
+    } else
+        capacity_ = VYTAL_APPLY_ALIGNMENT(parse_memory_size(value), MEMORY_ALIGNMENT_SIZE);
+
+    zone->_capacity      = capacity_;
+    zone->_peak_capacity = capacity_;
+
+    // reserved zones get an address range of their own, only their metadata stays in the pool
+    UIntPtr metadata_addr_ = *start_addr;
+    if (VYTAL_BITFLAG_IF_SET(zone->_flags, MEMORY_ZONE_FLAG_RESERVE)) {
+        zone->_reserved_size = VYTAL_APPLY_ALIGNMENT(capacity_, MEMORY_ZONE_COMMIT_GRANULARITY(zone->_flags));
+
+        if (platform_memory_reserve(zone->_reserved_size, VYTAL_BITFLAG_IF_SET(zone->_flags, MEMORY_ZONE_FLAG_HUGE_PAGES), &zone->_start_addr) != PLATFORM_MEMORY_SUCCESS)
+            return MEMORY_MANAGER_ERROR_ALLOCATION_FAILED;
+    } else {
+        zone->_start_addr = (VoidPtr)*start_addr;
+        metadata_addr_ += capacity_;
+    }
+
+    if (zone->_type == MEMORY_ZONE_TYPE_POOL)
+        memory_zone_pool_construct(zone, slot_count_, slot_size_, (VoidPtr)metadata_addr_);
+
+    // arenas bump without size classes
+    if (zone->_type == MEMORY_ZONE_TYPE_GENERAL) {
+        zone->_size_classes = (MemoryZoneSizeClass *)metadata_addr_;
+        memory_zone_compute_size_classes(&zone->_num_classes, &zone->_size_classes, capacity_);
+
+        if (VYTAL_BITFLAG_IF_SET(zone->_flags, MEMORY_ZONE_FLAG_CONCURRENT))
+            zone->_thread_caches = (VoidPtr)((UIntPtr)zone->_size_classes + (sizeof(MemoryZoneSizeClass) * zone->_num_classes));
+    }
+
+    *start_addr += _memory_manager_zone_footprint(capacity_, zone->_type, zone->_flags, slot_count_);
+    return MEMORY_MANAGER_SUCCESS;
+}
+
 MemoryManagerResult memory_manager_startup(File *file) {
     if (manager) return MEMORY_MANAGER_ERROR_ALREADY_INITIALIZED;
     if (!file) return MEMORY_MANAGER_ERROR_INVALID_PARAM;
     if (!file->_active || !file->_stream) return MEMORY_MANAGER_ERROR_FILE_INACTIVE_OR_INVALID_STREAM;
 
-    UInt32   num_zones_      = 0;
-    ByteSize total_capacity_ = 0;
-    Str      line_           = calloc(1, LINE_BUFFER_MAX_SIZE);
+    UInt32   num_zones_                           = 0;
+    ByteSize total_capacity_                      = 0;
+    Bool     declared_[MEMORY_ZONE_BUILTIN_COUNT] = {0};
+    Str      line_                                = calloc(1, LINE_BUFFER_MAX_SIZE);
 
     // save the section start position for second pass
     Int64 section_start_ = platform_filesystem_get_seek_position(file);
@@ -37,27 +226,37 @@ MemoryManagerResult memory_manager_startup(File *file) {
             Char value_[LINE_BUFFER_MAX_SIZE] = {0};
             if (!parse_key_value(trimmed_, key_, value_)) continue;
 
-            ByteSize num_sizeclasses_ = 0;
-            ByteSize capacity_        = parse_memory_size(value_);
-            memory_zone_compute_size_classes(&num_sizeclasses_, NULL, capacity_);
-            ByteSize sizeclasses_size_ = sizeof(MemoryZoneSizeClass) * num_sizeclasses_;
+            ByteSize slot_ = _memory_manager_builtin_zone_slot(key_);
+            if (slot_ != MEMORY_ZONE_BUILTIN_COUNT) declared_[slot_] = true;
 
-            total_capacity_ += ((ByteSize)capacity_ + sizeclasses_size_);
+            total_capacity_ += _memory_manager_declared_footprint(value_);
             ++num_zones_;
         }
 
+        // built-in zones missing from the config fall back to their defaults
+        for (ByteSize i = 0; i < MEMORY_ZONE_BUILTIN_COUNT; ++i) {
+            if (declared_[i] || !builtin_zone_defaults[i]) continue;
+
+            Char value_[LINE_BUFFER_MAX_SIZE] = {0};
+            strcpy(value_, builtin_zone_defaults[i]);
+            total_capacity_ += _memory_manager_declared_footprint(value_);
+        }
+
         // allocate a large chunk to cover entire memory manager
+        // (built-in zone slots are always reserved, so their handles index directly)
         {
             ByteSize manager_size_ = sizeof(MemoryManager);
-            ByteSize zones_size_   = sizeof(MemoryZone) * num_zones_;
+            ByteSize zones_size_   = sizeof(MemoryZone) * (MEMORY_ZONE_BUILTIN_COUNT + num_zones_);
+            ByteSize pool_offset_  = VYTAL_APPLY_ALIGNMENT(manager_size_ + zones_size_, MEMORY_ALIGNMENT_SIZE);
 
-            UIntPtr block_ = (UIntPtr)calloc(1, manager_size_ + zones_size_ + total_capacity_);
+            UIntPtr block_ = (UIntPtr)calloc(1, pool_offset_ + total_capacity_);
             if (!block_) return MEMORY_MANAGER_ERROR_ALLOCATION_FAILED;
 
-            manager            = (MemoryManager *)block_;
-            manager->_zones    = (MemoryZone *)(block_ + manager_size_);
-            manager->_pool     = (VoidPtr)(block_ + manager_size_ + zones_size_);
-            manager->_capacity = total_capacity_;
+            manager              = (MemoryManager *)block_;
+            manager->_zones      = (MemoryZone *)(block_ + manager_size_);
+            manager->_pool       = (VoidPtr)(block_ + pool_offset_);
+            manager->_capacity   = total_capacity_;
+            manager->_zone_count = MEMORY_ZONE_BUILTIN_COUNT;
         }
     }
 
@@ -84,16 +283,28 @@ MemoryManagerResult memory_manager_startup(File *file) {
             Char value_[LINE_BUFFER_MAX_SIZE] = {0};
             if (!parse_key_value(trimmed_, key_, value_)) continue;
 
-            MemoryZone *zone_  = &manager->_zones[manager->_zone_count++];
-            zone_->_name       = strdup(key_);
-            zone_->_start_addr = (VoidPtr)start_addr_;
+            // intern built-in zones into their fixed slots, append the others
+            ByteSize slot_ = _memory_manager_builtin_zone_slot(key_);
+            if (slot_ == MEMORY_ZONE_BUILTIN_COUNT)
+                slot_ = manager->_zone_count++;
+            else if (manager->_zones[slot_]._name)
+                continue;
+
+            if (_memory_manager_construct_zone(&manager->_zones[slot_], key_, value_, &start_addr_) != MEMORY_MANAGER_SUCCESS) {
+                free(line_);
+                return MEMORY_MANAGER_ERROR_ALLOCATION_FAILED;
+            }
+        }
 
-            ByteSize capacity_   = parse_memory_size(value_);
-            zone_->_size_classes = (MemoryZoneSizeClass *)(start_addr_ + capacity_);
-            memory_zone_compute_size_classes(&zone_->_num_classes, &zone_->_size_classes, capacity_);
-            zone_->_capacity = capacity_;
+        for (ByteSize i = 0; i < MEMORY_ZONE_BUILTIN_COUNT; ++i) {
+            if (manager->_zones[i]._name || !builtin_zone_defaults[i]) continue;
 
-            start_addr_ += (capacity_ + (sizeof(MemoryZoneSizeClass) * zone_->_num_classes));
+            Char value_[LINE_BUFFER_MAX_SIZE] = {0};
+            strcpy(value_, builtin_zone_defaults[i]);
+            if (_memory_manager_construct_zone(&manager->_zones[i], builtin_zone_names[i], value_, &start_addr_) != MEMORY_MANAGER_SUCCESS) {
+                free(line_);
+                return MEMORY_MANAGER_ERROR_ALLOCATION_FAILED;
+            }
         }
     }
 
@@ -106,15 +317,13 @@ MemoryManagerResult memory_manager_shutdown(void) {
 
     for (size_t i = 0; i < manager->_zone_count; ++i) {
         MemoryZone *zone_ = &manager->_zones[i];
+        memory_zone_report_leaks(zone_);
+        memory_zone_release_guarded(zone_);
 
-        for (size_t j = 0; j < zone_->_num_classes; ++j) {
-            MemoryZoneSizeClass *class_ = &zone_->_size_classes[j];
+        if (VYTAL_BITFLAG_IF_SET(zone_->_flags, MEMORY_ZONE_FLAG_RESERVE) && zone_->_start_addr)
+            platform_memory_release(zone_->_start_addr, zone_->_reserved_size);
 
-            if ((class_->_blocks) && (class_->_capacity > 0)) {
-                free(class_->_blocks);
-                class_->_blocks = NULL;
-            }
-        }
+        memory_zone_release_chunks(zone_);
 
         free(zone_->_name);
         zone_->_name = NULL;
@@ -126,12 +335,29 @@ MemoryManagerResult memory_manager_shutdown(void) {
     return MEMORY_MANAGER_SUCCESS;
 }
 
+MemoryManagerResult memory_manager_advance_frame(void) {
+    if (!manager) return MEMORY_MANAGER_ERROR_NOT_INITIALIZED;
+
+    for (size_t i = 0; i < manager->_zone_count; ++i) {
+        memory_zone_roll_frame_stats(&manager->_zones[i]);
+
+        if (manager->_zones[i]._type != MEMORY_ZONE_TYPE_FRAME_ARENA) continue;
+        memory_zone_advance_frame((MemoryZoneHandle)i);
+    }
+
+    return MEMORY_MANAGER_SUCCESS;
+}
+
 MemoryManager *memory_manager_get(void) {
     return manager;
 }
 
 ByteSize memory_manager_used_memory(void) {
-    return manager->_used_memory;
+    ByteSize used_memory_ = 0;
+    for (size_t i = 0; i < manager->_zone_count; ++i)
+        used_memory_ += __atomic_load_n(&manager->_zones[i]._used_memory, __ATOMIC_RELAXED);
+
+    return used_memory_;
 }
 
 ByteSize memory_manager_capacity(void) {
@@ -6,6 +6,7 @@
 
 VYTAL_API MemoryManagerResult memory_manager_startup(File *file);
 VYTAL_API MemoryManagerResult memory_manager_shutdown(void);
+VYTAL_API MemoryManagerResult memory_manager_advance_frame(void);
 
 VYTAL_API MemoryManager *memory_manager_get(void);
 VYTAL_API ByteSize       memory_manager_used_memory(void);
@@ -0,0 +1,67 @@
+#include "allocator_frame_arena.h"
+
+#include "vytal/core/memory/zone/memory_zone.h"
+
+// the region is split in two halves: one is bumped during the current frame,
+// the other keeps the previous frame's data alive until the next advance
+VYTAL_INLINE ByteSize _memory_zone_frame_arena_half(MemoryZone *zone) {
+    return (zone->_capacity / 2) & ~(ByteSize)(MEMORY_ALIGNMENT_SIZE - 1);
+}
+
+// end of a block placed at the first suitably aligned address past offset
+VYTAL_INLINE ByteSize _memory_zone_frame_arena_block_end(const UIntPtr base, const ByteSize offset, const ByteSize alignment, const ByteSize size) {
+    return (VYTAL_APPLY_ALIGNMENT(base + offset, alignment) - base) + size;
+}
+
+MemoryZoneResult memory_zone_frame_arena_allocate(MemoryZone *zone, const ByteSize size, const ByteSize alignment, VoidPtr *out_ptr, ByteSize *out_alloc_size) {
+    if (!zone || !size || !out_ptr) return MEMORY_ZONE_ERROR_INVALID_PARAM;
+
+    ByteSize half_         = _memory_zone_frame_arena_half(zone);
+    ByteSize aligned_size_ = VYTAL_APPLY_ALIGNMENT(size, MEMORY_ALIGNMENT_SIZE);
+    UIntPtr  base_         = (UIntPtr)zone->_start_addr + (zone->_frame_index * half_);
+    ByteSize offset_       = 0;
+    ByteSize end_          = 0;
+
+    if (VYTAL_BITFLAG_IF_SET(zone->_flags, MEMORY_ZONE_FLAG_CONCURRENT)) {
+        offset_ = __atomic_load_n(&zone->_bump_offset, __ATOMIC_RELAXED);
+        do {
+            end_ = _memory_zone_frame_arena_block_end(base_, offset_, alignment, aligned_size_);
+            if (end_ > half_) return MEMORY_ZONE_ERROR_INSUFFICIENT_MEMORY;
+        } while (!__atomic_compare_exchange_n(&zone->_bump_offset, &offset_, end_, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED));
+    }
+
+    else {
+        offset_ = zone->_bump_offset;
+        end_    = _memory_zone_frame_arena_block_end(base_, offset_, alignment, aligned_size_);
+        if (end_ > half_) return MEMORY_ZONE_ERROR_INSUFFICIENT_MEMORY;
+
+        zone->_bump_offset = end_;
+    }
+
+    MemoryZoneResult commit_ = memory_zone_ensure_committed(zone, (zone->_frame_index * half_) + end_);
+    if (commit_ != MEMORY_ZONE_SUCCESS)
+        return commit_;
+
+    // alignment padding counts as used until the frame is dropped
+    if (VYTAL_BITFLAG_IF_SET(zone->_flags, MEMORY_ZONE_FLAG_CONCURRENT))
+        __atomic_add_fetch(&zone->_used_memory, end_ - offset_, __ATOMIC_RELAXED);
+    else
+        zone->_used_memory += end_ - offset_;
+
+    *out_ptr = (VoidPtr)(base_ + end_ - aligned_size_);
+    if (out_alloc_size)
+        *out_alloc_size = aligned_size_;
+
+    return MEMORY_ZONE_SUCCESS;
+}
+
+MemoryZoneResult memory_zone_frame_arena_advance(MemoryZone *zone) {
+    if (!zone) return MEMORY_ZONE_ERROR_INVALID_PARAM;
+
+    // the half bumped this frame becomes the surviving one, the other is dropped
+    zone->_used_memory = zone->_bump_offset;
+    zone->_bump_offset = 0;
+    zone->_frame_index ^= 1;
+
+    return MEMORY_ZONE_SUCCESS;
+}
@@ -0,0 +1,7 @@
+#pragma once
+
+#include "vytal/defines/core/memory.h"
+#include "vytal/defines/shared.h"
+
+VYTAL_API MemoryZoneResult memory_zone_frame_arena_allocate(MemoryZone *zone, const ByteSize size, const ByteSize alignment, VoidPtr *out_ptr, ByteSize *out_alloc_size);
+VYTAL_API MemoryZoneResult memory_zone_frame_arena_advance(MemoryZone *zone);
@@ -0,0 +1,159 @@
+#include "allocator_pool.h"
+
+#include <string.h>
+
+#include "vytal/core/memory/zone/memory_zone.h"
+
+// pool handles pack the slot index in the low half and its generation in the high half
+#define POOL_HANDLE_INDEX(pool_handle) ((ByteSize)((pool_handle) & 0xffffffffull))
+#define POOL_HANDLE_GENERATION(pool_handle) ((UInt32)((pool_handle) >> 32))
+#define POOL_HANDLE_PACK(index, generation) ((MemoryZonePoolHandle)(index) | ((MemoryZonePoolHandle)(generation) << 32))
+
+#define POOL_BITMAP_WORDS(slot_count) (((slot_count) + 63) / 64)
+
+VYTAL_INLINE VoidPtr _memory_zone_pool_slot_addr(MemoryZone *zone, const ByteSize index) {
+    return (VoidPtr)((UIntPtr)zone->_start_addr + (index * zone->_pool._slot_size));
+}
+
+VYTAL_INLINE Bool _memory_zone_pool_is_live(MemoryZone *zone, const ByteSize index) {
+    return (zone->_pool._live_slots[index / 64] >> (index % 64)) & 1;
+}
+
+// maps a pointer back to its slot, rejecting anything that is not the start of a live slot
+MemoryZoneResult _memory_zone_pool_slot_index(MemoryZone *zone, const VoidPtr ptr, ByteSize *out_index) {
+    UIntPtr start_ = (UIntPtr)zone->_start_addr;
+    if ((UIntPtr)ptr < start_) return MEMORY_ZONE_ERROR_INVALID_POINTER;
+
+    ByteSize offset_ = (UIntPtr)ptr - start_;
+    ByteSize index_  = offset_ / zone->_pool._slot_size;
+
+    if ((index_ >= zone->_pool._slot_count) || (offset_ % zone->_pool._slot_size != 0)) return MEMORY_ZONE_ERROR_INVALID_POINTER;
+    if (!_memory_zone_pool_is_live(zone, index_)) return MEMORY_ZONE_ERROR_INVALID_POINTER;
+
+    *out_index = index_;
+    return MEMORY_ZONE_SUCCESS;
+}
+
+ByteSize memory_zone_pool_compute_metadata_size(const ByteSize slot_count) {
+    ByteSize free_slots_size_  = VYTAL_APPLY_ALIGNMENT(sizeof(UInt32) * slot_count, MEMORY_ALIGNMENT_SIZE);
+    ByteSize generations_size_ = VYTAL_APPLY_ALIGNMENT(sizeof(UInt32) * slot_count, MEMORY_ALIGNMENT_SIZE);
+    ByteSize live_slots_size_  = VYTAL_APPLY_ALIGNMENT(sizeof(UInt64) * POOL_BITMAP_WORDS(slot_count), MEMORY_ALIGNMENT_SIZE);
+
+    return free_slots_size_ + generations_size_ + live_slots_size_;
+}
+
+void memory_zone_pool_construct(MemoryZone *zone, const ByteSize slot_count, const ByteSize slot_size, VoidPtr metadata) {
+    zone->_pool._slot_count = slot_count;
+    zone->_pool._slot_size  = slot_size;
+
+    UIntPtr metadata_        = (UIntPtr)metadata;
+    zone->_pool._free_slots  = (UInt32 *)metadata_;
+    zone->_pool._generations = (UInt32 *)(metadata_ += VYTAL_APPLY_ALIGNMENT(sizeof(UInt32) * slot_count, MEMORY_ALIGNMENT_SIZE));
+    zone->_pool._live_slots  = (UInt64 *)(metadata_ += VYTAL_APPLY_ALIGNMENT(sizeof(UInt32) * slot_count, MEMORY_ALIGNMENT_SIZE));
+
+    memory_zone_pool_clear(zone);
+}
+
+void memory_zone_pool_clear(MemoryZone *zone) {
+    MemoryZonePool *pool_ = &zone->_pool;
+
+    // whatever was live goes stale
+    for (ByteSize i = 0; i < pool_->_slot_count; ++i)
+        if (_memory_zone_pool_is_live(zone, i)) ++pool_->_generations[i];
+
+    memset(pool_->_live_slots, 0, sizeof(UInt64) * POOL_BITMAP_WORDS(pool_->_slot_count));
+
+    // stacked in reverse, so slots are handed out front to back
+    for (ByteSize i = 0; i < pool_->_slot_count; ++i)
+        pool_->_free_slots[i] = (UInt32)(pool_->_slot_count - 1 - i);
+
+    pool_->_num_free   = pool_->_slot_count;
+    zone->_used_memory = 0;
+}
+
+MemoryZoneResult memory_zone_pool_allocate(MemoryZone *zone, const ByteSize size, VoidPtr *out_ptr, ByteSize *out_alloc_size) {
+    if (!zone || !size || !out_ptr) return MEMORY_ZONE_ERROR_INVALID_PARAM;
+    if (size > zone->_pool._slot_size) return MEMORY_ZONE_ERROR_INVALID_PARAM;
+    if (!zone->_pool._num_free) return MEMORY_ZONE_ERROR_INSUFFICIENT_MEMORY;
+
+    ByteSize index_ = zone->_pool._free_slots[zone->_pool._num_free - 1];
+
+    MemoryZoneResult commit_ = memory_zone_ensure_committed(zone, (index_ + 1) * zone->_pool._slot_size);
+    if (commit_ != MEMORY_ZONE_SUCCESS)
+        return commit_;
+
+    --zone->_pool._num_free;
+    zone->_pool._live_slots[index_ / 64] |= (1ull << (index_ % 64));
+    zone->_used_memory += zone->_pool._slot_size;
+
+    *out_ptr = _memory_zone_pool_slot_addr(zone, index_);
+    if (out_alloc_size)
+        *out_alloc_size = zone->_pool._slot_size;
+
+    return MEMORY_ZONE_SUCCESS;
+}
+
+MemoryZoneResult memory_zone_pool_deallocate(MemoryZone *zone, const VoidPtr ptr) {
+    if (!zone || !ptr) return MEMORY_ZONE_ERROR_INVALID_PARAM;
+
+    ByteSize         index_      = 0;
+    MemoryZoneResult slot_index_ = _memory_zone_pool_slot_index(zone, ptr, &index_);
+    if (slot_index_ != MEMORY_ZONE_SUCCESS)
+        return slot_index_;
+
+    // outstanding handles to this slot go stale
+    ++zone->_pool._generations[index_];
+
+    zone->_pool._live_slots[index_ / 64] &= ~(1ull << (index_ % 64));
+    zone->_pool._free_slots[zone->_pool._num_free++] = (UInt32)index_;
+    zone->_used_memory -= zone->_pool._slot_size;
+
+    return MEMORY_ZONE_SUCCESS;
+}
+
+MemoryZoneResult memory_zone_pool_get_handle(MemoryZone *zone, const VoidPtr ptr, MemoryZonePoolHandle *out_pool_handle) {
+    if (!zone || !ptr || !out_pool_handle) return MEMORY_ZONE_ERROR_INVALID_PARAM;
+
+    ByteSize         index_      = 0;
+    MemoryZoneResult slot_index_ = _memory_zone_pool_slot_index(zone, ptr, &index_);
+    if (slot_index_ != MEMORY_ZONE_SUCCESS)
+        return slot_index_;
+
+    *out_pool_handle = POOL_HANDLE_PACK(index_, zone->_pool._generations[index_]);
+    return MEMORY_ZONE_SUCCESS;
+}
+
+MemoryZoneResult memory_zone_pool_resolve_handle(MemoryZone *zone, const MemoryZonePoolHandle pool_handle, VoidPtr *out_ptr) {
+    if (!zone || !out_ptr) return MEMORY_ZONE_ERROR_INVALID_PARAM;
+
+    ByteSize index_ = POOL_HANDLE_INDEX(pool_handle);
+    if (index_ >= zone->_pool._slot_count) return MEMORY_ZONE_ERROR_INVALID_POINTER;
+
+    // stale handle, the slot was released (and possibly reused) since
+    if (!_memory_zone_pool_is_live(zone, index_) || (zone->_pool._generations[index_] != POOL_HANDLE_GENERATION(pool_handle)))
+        return MEMORY_ZONE_ERROR_INVALID_POINTER;
+
+    *out_ptr = _memory_zone_pool_slot_addr(zone, index_);
+    return MEMORY_ZONE_SUCCESS;
+}
+
+MemoryZoneResult memory_zone_pool_next_live(MemoryZone *zone, ByteSize *cursor, VoidPtr *out_ptr) {
+    if (!zone || !cursor || !out_ptr) return MEMORY_ZONE_ERROR_INVALID_PARAM;
+
+    // walk the bitmap a word at a time, skipping empty stretches
+    for (ByteSize word_ = *cursor / 64; word_ < POOL_BITMAP_WORDS(zone->_pool._slot_count); ++word_) {
+        UInt64 bits_ = zone->_pool._live_slots[word_];
+        if (word_ == *cursor / 64)
+            bits_ &= ~0ull << (*cursor % 64);
+
+        if (bits_) {
+            ByteSize index_ = (word_ * 64) + __builtin_ctzll(bits_);
+
+            *out_ptr = _memory_zone_pool_slot_addr(zone, index_);
+            *cursor  = index_ + 1;
+            return MEMORY_ZONE_SUCCESS;
+        }
+    }
+
+    return MEMORY_ZONE_ERROR_NOT_EXIST;
+}
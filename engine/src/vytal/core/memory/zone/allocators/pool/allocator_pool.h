@@ -0,0 +1,15 @@
+#pragma once
+
+#include "vytal/defines/core/memory.h"
+#include "vytal/defines/shared.h"
+
+VYTAL_API ByteSize memory_zone_pool_compute_metadata_size(const ByteSize slot_count);
+VYTAL_API void     memory_zone_pool_construct(MemoryZone *zone, const ByteSize slot_count, const ByteSize slot_size, VoidPtr metadata);
+VYTAL_API void     memory_zone_pool_clear(MemoryZone *zone);
+
+VYTAL_API MemoryZoneResult memory_zone_pool_allocate(MemoryZone *zone, const ByteSize size, VoidPtr *out_ptr, ByteSize *out_alloc_size);
+VYTAL_API MemoryZoneResult memory_zone_pool_deallocate(MemoryZone *zone, const VoidPtr ptr);
+
+VYTAL_API MemoryZoneResult memory_zone_pool_get_handle(MemoryZone *zone, const VoidPtr ptr, MemoryZonePoolHandle *out_pool_handle);
+VYTAL_API MemoryZoneResult memory_zone_pool_resolve_handle(MemoryZone *zone, const MemoryZonePoolHandle pool_handle, VoidPtr *out_ptr);
+VYTAL_API MemoryZoneResult memory_zone_pool_next_live(MemoryZone *zone, ByteSize *cursor, VoidPtr *out_ptr);
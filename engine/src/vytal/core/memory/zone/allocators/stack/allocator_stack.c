@@ -0,0 +1,61 @@
+#include "allocator_stack.h"
+
+#include "vytal/core/memory/zone/memory_zone.h"
+
+MemoryZoneResult memory_zone_stack_allocate(MemoryZone *zone, const ByteSize size, const ByteSize alignment, VoidPtr *out_ptr, ByteSize *out_alloc_size) {
+    if (!zone || !size || !out_ptr) return MEMORY_ZONE_ERROR_INVALID_PARAM;
+
+    UIntPtr  start_        = (UIntPtr)zone->_start_addr;
+    ByteSize offset_       = VYTAL_APPLY_ALIGNMENT(start_ + zone->_bump_offset, alignment) - start_;
+    ByteSize aligned_size_ = VYTAL_APPLY_ALIGNMENT(size, MEMORY_ALIGNMENT_SIZE);
+    if (offset_ + aligned_size_ > zone->_capacity) return MEMORY_ZONE_ERROR_INSUFFICIENT_MEMORY;
+
+    MemoryZoneResult commit_ = memory_zone_ensure_committed(zone, offset_ + aligned_size_);
+    if (commit_ != MEMORY_ZONE_SUCCESS)
+        return commit_;
+
+    // the alignment gap below the block is only reclaimed by popping a marker
+    *out_ptr           = (VoidPtr)(start_ + offset_);
+    zone->_bump_offset = offset_ + aligned_size_;
+    zone->_used_memory = zone->_bump_offset;
+
+    if (out_alloc_size)
+        *out_alloc_size = aligned_size_;
+
+    return MEMORY_ZONE_SUCCESS;
+}
+
+MemoryZoneResult memory_zone_stack_deallocate(MemoryZone *zone, const VoidPtr ptr, const ByteSize size) {
+    if (!zone || !ptr || !size) return MEMORY_ZONE_ERROR_INVALID_PARAM;
+
+    ByteSize offset_ = (UIntPtr)ptr - (UIntPtr)zone->_start_addr;
+    if (offset_ >= zone->_bump_offset) return MEMORY_ZONE_ERROR_INVALID_POINTER;
+
+    // only the top of the stack can be given back early,
+    // anything below it is released with its marker
+    if (offset_ + VYTAL_APPLY_ALIGNMENT(size, MEMORY_ALIGNMENT_SIZE) == zone->_bump_offset) {
+        zone->_bump_offset = offset_;
+        zone->_used_memory = offset_;
+    }
+
+    return MEMORY_ZONE_SUCCESS;
+}
+
+MemoryZoneResult memory_zone_stack_push_marker(MemoryZone *zone, MemoryZoneMarker *out_marker) {
+    if (!zone || !out_marker) return MEMORY_ZONE_ERROR_INVALID_PARAM;
+
+    *out_marker = zone->_bump_offset;
+    return MEMORY_ZONE_SUCCESS;
+}
+
+MemoryZoneResult memory_zone_stack_pop_to_marker(MemoryZone *zone, const MemoryZoneMarker marker) {
+    if (!zone) return MEMORY_ZONE_ERROR_INVALID_PARAM;
+
+    // popping past the top means the marker belongs to an already released scope
+    if (marker > zone->_bump_offset) return MEMORY_ZONE_ERROR_INVALID_PARAM;
+
+    zone->_bump_offset = marker;
+    zone->_used_memory = marker;
+
+    return MEMORY_ZONE_SUCCESS;
+}
@@ -0,0 +1,9 @@
+#pragma once
+
+#include "vytal/defines/core/memory.h"
+#include "vytal/defines/shared.h"
+
+VYTAL_API MemoryZoneResult memory_zone_stack_allocate(MemoryZone *zone, const ByteSize size, const ByteSize alignment, VoidPtr *out_ptr, ByteSize *out_alloc_size);
+VYTAL_API MemoryZoneResult memory_zone_stack_deallocate(MemoryZone *zone, const VoidPtr ptr, const ByteSize size);
+VYTAL_API MemoryZoneResult memory_zone_stack_push_marker(MemoryZone *zone, MemoryZoneMarker *out_marker);
+VYTAL_API MemoryZoneResult memory_zone_stack_pop_to_marker(MemoryZone *zone, const MemoryZoneMarker marker);
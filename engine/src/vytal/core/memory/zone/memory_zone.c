@@ -4,83 +4,216 @@
 #include <stdlib.h>
 #include <string.h>
 
+#if defined(__SSE2__)
+#    include <immintrin.h>
+#endif
+
+#if defined(_MSC_VER)
+#    include <intrin.h>
+#endif
+
 #include "vytal/core/memory/manager/memory_manager.h"
+#include "vytal/core/memory/zone/allocators/frame_arena/allocator_frame_arena.h"
+#include "vytal/core/memory/zone/allocators/pool/allocator_pool.h"
+#include "vytal/core/memory/zone/allocators/stack/allocator_stack.h"
+#include "vytal/core/platform/memory/memory.h"
 
-VYTAL_INLINE void _memory_zone_compute_size_classes(ByteSize *out_num_classes, MemoryZoneSizeClass **out_size_classes, const ByteSize capacity) {
-    if (!out_num_classes || !capacity) return;
+// the definitions below are the untagged entry points
+#if defined(VYTAL_MEMORY_TRACK_CALLSITES)
+#    undef memory_zone_allocate
+#    undef memory_zone_allocate_aligned
+#    undef memory_zone_allocate_zeroed
+#endif
+
+// boundary tag in front of every block of a coalescing zone
+typedef struct Memory_Zone_Block_Tag {
+    ByteSize _size;       // whole block, tag included; lowest bit marks the block as free
+    ByteSize _prev_size;  // physically preceding block (0 at the zone start)
+} MemoryZoneBlockTag;
+
+// free blocks keep their list links in place of the payload
+typedef struct Memory_Zone_Free_Block {
+    struct Memory_Zone_Free_Block *_next;
+    struct Memory_Zone_Free_Block *_prev;
+} MemoryZoneFreeBlock;
+
+#define BLOCK_TAG_SIZE VYTAL_APPLY_ALIGNMENT(sizeof(MemoryZoneBlockTag), MEMORY_ALIGNMENT_SIZE)
+#define BLOCK_FREE_BIT ((ByteSize)1)
+
+#define CHUNK_HEADER_SIZE VYTAL_APPLY_ALIGNMENT(sizeof(MemoryZoneChunk), MEMORY_ALIGNMENT_SIZE)
+
+#if defined(VYTAL_MEMORY_DEBUG)
+// sits right below every block a debug build hands out; live blocks are chained per zone for the leak report
+typedef struct Memory_Zone_Debug_Header {
+    struct Memory_Zone_Debug_Header *_prev;
+    struct Memory_Zone_Debug_Header *_next;
+    ByteSize                         _size;
+    ConstStr                         _file;  // VYTAL_MEMORY_TRACK_CALLSITES builds only
+    Int32                            _line;
+    VoidPtr                          _mapping;  // guarded blocks only: their reserved range
+    ByteSize                         _mapping_size;
+    UInt64                           _canary;  // touches the payload
+} MemoryZoneDebugHeader;
+
+#    define DEBUG_CANARY 0xfdfdfdfdfdfdfdfdull
+#    define DEBUG_CANARY_SIZE sizeof(UInt64)
+#    define DEBUG_POISON_FRESH 0xcd
+#    define DEBUG_POISON_FREED 0xdd
+#endif
+
+typedef struct Memory_Zone_Magazine {
+    VoidPtr  _blocks[MEMORY_ZONE_MAGAZINE_SIZE];
+    ByteSize _num_blocks;
+} MemoryZoneMagazine;
+
+// header of a snapshot mapping; the copied bookkeeping and contents follow it
+struct Memory_Zone_Snapshot {
+    MemoryZoneHandle _zone;
+    ByteSize         _size;  // mapped bytes, header included
 
-    const Flt32 ratio_ = 1.618f;
+    ByteSize _used_memory;
+    ByteSize _bump_offset;
+    ByteSize _tail_size;
+    ByteSize _dirty_offset;
+    ByteSize _frame_index;
+    ByteSize _requested_memory;
+    ByteSize _pool_num_free;
 
-    ByteSize current_size_ = 4;
-    ByteSize index_        = 0;
+    ByteSize _extent;  // bytes of the zone's own region copied
+    ByteSize _num_chunks;
 
-    for (; current_size_ <= capacity; ++index_) {
-        if (out_size_classes)
-            (*out_size_classes)[index_]._size = VYTAL_APPLY_ALIGNMENT(current_size_, MEMORY_ALIGNMENT_SIZE);
+    // the headers are part of the contents; guarded debug blocks live outside the zone, so none may be live
+    VoidPtr _debug_blocks;
+};
 
-        current_size_ = (ByteSize)((Flt32)current_size_ * ratio_);
+typedef struct Memory_Zone_Snapshot_Chunk {
+    MemoryZoneChunk *_chunk;
+    ByteSize         _bump_offset;
+} MemoryZoneSnapshotChunk;
+
+// thread slots are shared by all concurrent zones; threads past MEMORY_ZONE_THREAD_CACHES
+// (and slots of exited threads, which are never recycled) fall back to the locked free lists
+static VYTAL_THREAD_LOCAL Int32 thread_cache_slot  = -1;
+static volatile Int32           thread_cache_count = 0;
+
+#if defined(VYTAL_MEMORY_TRACK_CALLSITES)
+// open-addressed on the (file, line) pair; callsites past the last free slot go unrecorded
+static MemoryZoneCallsiteStats callsites[MEMORY_ZONE_CALLSITE_SLOTS];
+static volatile Int32          callsites_lock = 0;
+
+static VYTAL_THREAD_LOCAL ConstStr callsite_file = NULL;
+static VYTAL_THREAD_LOCAL Int32    callsite_line = 0;
+#endif
+
+VYTAL_INLINE void _memory_zone_lock(volatile Int32 *lock) {
+    while (__atomic_exchange_n(lock, 1, __ATOMIC_ACQUIRE)) {
+        while (__atomic_load_n(lock, __ATOMIC_RELAXED)) {
+#if defined(__SSE2__)
+            _mm_pause();
+#endif
+        }
     }
+}
 
-    if (out_size_classes)
-        (*out_size_classes)[index_]._size = capacity;
+VYTAL_INLINE void _memory_zone_unlock(volatile Int32 *lock) {
+    __atomic_store_n(lock, 0, __ATOMIC_RELEASE);
+}
+
+#if defined(VYTAL_MEMORY_DEBUG)
+// pool slots have a fixed size, so pools only get poisoned
+VYTAL_INLINE ByteSize _memory_zone_debug_header_size(MemoryZone *zone, const ByteSize alignment) {
+    return (zone->_type == MEMORY_ZONE_TYPE_POOL) ? 0 : VYTAL_APPLY_ALIGNMENT(sizeof(MemoryZoneDebugHeader), alignment);
+}
+
+VYTAL_INLINE Bool _memory_zone_debug_guarded(MemoryZone *zone, const ByteSize size) {
+    return MEMORY_ZONE_GUARD_PAGE_THRESHOLD && (zone->_type == MEMORY_ZONE_TYPE_GENERAL) && (size >= MEMORY_ZONE_GUARD_PAGE_THRESHOLD);
+}
 
-    *out_num_classes = ++index_;
+// committed part of a guarded mapping; one more uncommitted granule follows it
+VYTAL_INLINE ByteSize _memory_zone_debug_guarded_size(const ByteSize size, const ByteSize alignment) {
+    return VYTAL_APPLY_ALIGNMENT(VYTAL_APPLY_ALIGNMENT(sizeof(MemoryZoneDebugHeader), alignment) + VYTAL_APPLY_ALIGNMENT(size, alignment), MEMORY_ZONE_COMMIT_SIZE);
 }
+#endif
+
+VYTAL_INLINE ByteSize _memory_zone_floor_log2(const ByteSize value) {
+#if defined(__GNUC__) || defined(__clang__)
+    return 63 - __builtin_clzll(value);
+
+#elif defined(_MSC_VER)
+    unsigned long index_;
+    _BitScanReverse64(&index_, value);
+    return (ByteSize)index_;
 
-VYTAL_INLINE ByteSize _memory_zone_log2_size(ByteSize size) {
+#else
     ByteSize log2_ = 0;
+    while (value >> (log2_ + 1)) ++log2_;
+    return log2_;
 
-#if __x86_64__
-    if (size >= (1ull << 32)) {
-        size >>= 32;
-        log2_ += 32;
-    }
 #endif
+}
 
-    if (size >= (1 << 16)) {
-        size >>= 16;
-        log2_ += 16;
-    }
-    if (size >= (1 << 8)) {
-        size >>= 8;
-        log2_ += 8;
-    }
-    if (size >= (1 << 4)) {
-        size >>= 4;
-        log2_ += 4;
-    }
-    if (size >= (1 << 2)) {
-        size >>= 2;
-        log2_ += 2;
-    }
-    if (size >= (1 << 1)) {
-        size >>= 1;
-        log2_ += 1;
+// size classes are spaced like jemalloc's: one MEMORY_ALIGNMENT_SIZE step apart up to SIZE_CLASS_GROUP
+// steps, then SIZE_CLASS_GROUP evenly spaced classes per doubling, so a block wastes less than
+// 1 / SIZE_CLASS_GROUP of its size; the index falls out of the bit length without branches or walks
+#define SIZE_CLASS_GROUP ((ByteSize)1 << MEMORY_ZONE_SIZE_CLASS_GROUP_BITS)
+#define SIZE_CLASS_LG_QUANTUM _memory_zone_floor_log2(MEMORY_ALIGNMENT_SIZE)
+
+VYTAL_INLINE ByteSize _memory_zone_size_class_of(const ByteSize size) {
+    ByteSize value_ = size - 1;
+    ByteSize lg_    = _memory_zone_floor_log2(value_ | ((ByteSize)1 << (SIZE_CLASS_LG_QUANTUM + MEMORY_ZONE_SIZE_CLASS_GROUP_BITS)));
+
+    return ((lg_ - SIZE_CLASS_LG_QUANTUM - MEMORY_ZONE_SIZE_CLASS_GROUP_BITS) << MEMORY_ZONE_SIZE_CLASS_GROUP_BITS) + (value_ >> (lg_ - MEMORY_ZONE_SIZE_CLASS_GROUP_BITS));
+}
+
+VYTAL_INLINE ByteSize _memory_zone_size_class_size(const ByteSize index) {
+    if (index < SIZE_CLASS_GROUP) return (index + 1) << SIZE_CLASS_LG_QUANTUM;
+
+    ByteSize doubling_ = (index >> MEMORY_ZONE_SIZE_CLASS_GROUP_BITS) - 1;
+    return (SIZE_CLASS_GROUP + (index & (SIZE_CLASS_GROUP - 1)) + 1) << (SIZE_CLASS_LG_QUANTUM + doubling_);
+}
+
+VYTAL_INLINE void _memory_zone_compute_size_classes(ByteSize *out_num_classes, MemoryZoneSizeClass **out_size_classes, const ByteSize capacity) {
+    if (!out_num_classes || !capacity) return;
+
+    ByteSize num_classes_ = _memory_zone_size_class_of(capacity) + 1;
+
+    // the last class is cut down to the capacity, so the whole zone stays allocatable in one block
+    if (out_size_classes) {
+        for (ByteSize i = 0; i < num_classes_; ++i) {
+            ByteSize size_               = _memory_zone_size_class_size(i);
+            (*out_size_classes)[i]._size = (size_ < capacity) ? size_ : capacity;
+        }
     }
 
-    return log2_;
+    *out_num_classes = num_classes_;
 }
 
+// smallest class that fits (the last one if none does)
 ByteSize _memory_zone_get_size_class_index(MemoryZone *zone, const ByteSize size) {
-    const Flt32 log2_ratio_ = 0.694f;
-
-    ByteSize aligned_size_ = VYTAL_APPLY_ALIGNMENT(size, MEMORY_ALIGNMENT_SIZE);
-    ByteSize log2_size_    = _memory_zone_log2_size(aligned_size_);
+    ByteSize index_ = _memory_zone_size_class_of(size);
+    return (index_ < zone->_num_classes) ? index_ : zone->_num_classes - 1;
+}
 
-    ByteSize index_ = (ByteSize)((Flt32)log2_size_ / log2_ratio_);
-    while (index_ > 0 && aligned_size_ <= zone->_size_classes[index_]._size) --index_;
+VYTAL_INLINE MemoryZone *_memory_zone_resolve(const MemoryZoneHandle handle) {
+    MemoryManager *manager_ = memory_manager_get();
+    if (!manager_ || (ByteSize)handle >= manager_->_zone_count) return NULL;
 
-    return (index_ >= zone->_num_classes) ? zone->_num_classes - 1 : index_ + 1;
+    // built-in slots stay empty when the config does not declare them
+    MemoryZone *zone_ = &manager_->_zones[handle];
+    return zone_->_capacity ? zone_ : NULL;
 }
 
-MemoryZoneResult memory_zone_get(ConstStr zone_name, MemoryZone **out_zone) {
+MemoryZoneResult memory_zone_get_handle(ConstStr zone_name, MemoryZoneHandle *out_handle) {
+    if (!zone_name || !out_handle) return MEMORY_ZONE_ERROR_INVALID_PARAM;
+
     MemoryManager *manager_ = memory_manager_get();
+    if (!manager_) return MEMORY_ZONE_ERROR_NOT_EXIST;
 
     for (size_t i = 0; i < manager_->_zone_count; ++i) {
         MemoryZone *zone_ = &manager_->_zones[i];
 
-        if (!strcmp(zone_->_name, zone_name)) {
-            *out_zone = zone_;
+        if (zone_->_name && !strcmp(zone_->_name, zone_name)) {
+            *out_handle = (MemoryZoneHandle)i;
             return MEMORY_ZONE_SUCCESS;
         }
     }
@@ -88,87 +221,1545 @@ MemoryZoneResult memory_zone_get(ConstStr zone_name, MemoryZone **out_zone) {
     return MEMORY_ZONE_ERROR_NOT_EXIST;
 }
 
-MemoryZoneResult memory_zone_clear(ConstStr zone_name) {
-    MemoryZone      *zone_;
-    MemoryZoneResult get_zone_ = memory_zone_get(zone_name, &zone_);
-    if (get_zone_ != MEMORY_ZONE_SUCCESS) return get_zone_;
+MemoryZoneResult memory_zone_get(const MemoryZoneHandle handle, MemoryZone **out_zone) {
+    if (!out_zone) return MEMORY_ZONE_ERROR_INVALID_PARAM;
+
+    MemoryZone *zone_ = _memory_zone_resolve(handle);
+    if (!zone_) return MEMORY_ZONE_ERROR_NOT_EXIST;
+
+    *out_zone = zone_;
+    return MEMORY_ZONE_SUCCESS;
+}
+
+MemoryZoneResult memory_zone_clear(const MemoryZoneHandle handle) {
+    MemoryZone *zone_ = _memory_zone_resolve(handle);
+    if (!zone_) return MEMORY_ZONE_ERROR_NOT_EXIST;
+
+    // walks the debug list, so it goes before the list and the pages holding it do
+    memory_zone_release_guarded(zone_);
+
+    // drop the free lists and live counts but keep the class sizes and totals
+    for (size_t i = 0; i < zone_->_num_classes; ++i) {
+        zone_->_size_classes[i]._free_list        = NULL;
+        zone_->_size_classes[i]._num_blocks       = 0;
+        zone_->_size_classes[i]._live_blocks      = 0;
+        zone_->_size_classes[i]._requested_memory = 0;
+    }
+
+    zone_->_requested_memory = 0;
+    zone_->_debug_blocks     = NULL;
+
+    if (zone_->_thread_caches)
+        memset(zone_->_thread_caches, 0, memory_zone_compute_thread_caches_size(zone_->_num_classes));
+
+    // reserved zones hand their pages back, which leaves them zeroed; the others keep their contents
+    // and only remember how far they got, so zeroed allocations know what still has to be cleared
+    if (VYTAL_BITFLAG_IF_SET(zone_->_flags, MEMORY_ZONE_FLAG_RESERVE)) {
+        if (zone_->_committed && (platform_memory_decommit(zone_->_start_addr, zone_->_committed) != PLATFORM_MEMORY_SUCCESS))
+            return MEMORY_ZONE_ERROR_MEMORY_ALLOCATION;
+
+        zone_->_committed    = 0;
+        zone_->_dirty_offset = 0;
+    } else if (zone_->_bump_offset > zone_->_dirty_offset)
+        zone_->_dirty_offset = zone_->_bump_offset;
 
-    for (size_t i = 0; i < zone_->_num_classes; ++i)
-        memset(&zone_->_size_classes[i], 0, sizeof(MemoryZoneSizeClass));
+    // grown zones shrink back to their configured capacity
+    memory_zone_release_chunks(zone_);
 
-    memset((VoidPtr)zone_->_start_addr, 0, zone_->_capacity);
     zone_->_used_memory = 0;
+    zone_->_bump_offset = 0;
+    zone_->_tail_size   = 0;
+    zone_->_frame_index = 0;
+
+    if (zone_->_type == MEMORY_ZONE_TYPE_POOL)
+        memory_zone_pool_clear(zone_);
+
+    return MEMORY_ZONE_SUCCESS;
+}
+
+static MemoryZoneMagazine *_memory_zone_get_magazine(MemoryZone *zone, const ByteSize index) {
+    if (thread_cache_slot < 0)
+        thread_cache_slot = __atomic_fetch_add(&thread_cache_count, 1, __ATOMIC_RELAXED);
+
+    if (thread_cache_slot >= MEMORY_ZONE_THREAD_CACHES) return NULL;
+
+    return &((MemoryZoneMagazine *)zone->_thread_caches)[(thread_cache_slot * zone->_num_classes) + index];
+}
+
+// guarded debug blocks live outside the zone but still count against it: against the grow cap
+// in growable zones, against the zone's own region in the others
+VYTAL_INLINE ByteSize _memory_zone_charged_capacity(MemoryZone *zone) {
+    ByteSize charged_ = zone->_capacity + zone->_grown_capacity;
+
+#if defined(VYTAL_MEMORY_DEBUG)
+    charged_ += __atomic_load_n(&zone->_guarded_memory, __ATOMIC_RELAXED);
+#endif
+
+    return charged_;
+}
+
+VYTAL_INLINE ByteSize _memory_zone_region_limit(MemoryZone *zone) {
+#if defined(VYTAL_MEMORY_DEBUG)
+    if (!VYTAL_BITFLAG_IF_SET(zone->_flags, MEMORY_ZONE_FLAG_GROWABLE)) {
+        ByteSize guarded_ = __atomic_load_n(&zone->_guarded_memory, __ATOMIC_RELAXED);
+        return (guarded_ < zone->_capacity) ? zone->_capacity - guarded_ : 0;
+    }
+#endif
+
+    return zone->_capacity;
+}
+
+VYTAL_INLINE VoidPtr _memory_zone_bump_region(MemoryZone *zone, const ByteSize size) {
+    ByteSize limit_ = _memory_zone_region_limit(zone);
+
+    if (!VYTAL_BITFLAG_IF_SET(zone->_flags, MEMORY_ZONE_FLAG_CONCURRENT)) {
+        if (zone->_bump_offset + size > limit_) return NULL;
+        if (memory_zone_ensure_committed(zone, zone->_bump_offset + size) != MEMORY_ZONE_SUCCESS) return NULL;
+
+        VoidPtr ptr_ = (VoidPtr)((UIntPtr)zone->_start_addr + zone->_bump_offset);
+        zone->_bump_offset += size;
+        return ptr_;
+    }
+
+    ByteSize offset_ = __atomic_load_n(&zone->_bump_offset, __ATOMIC_RELAXED);
+    do {
+        if (offset_ + size > limit_) return NULL;
+    } while (!__atomic_compare_exchange_n(&zone->_bump_offset, &offset_, offset_ + size, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED));
+
+    if (memory_zone_ensure_committed(zone, offset_ + size) != MEMORY_ZONE_SUCCESS) return NULL;
+    return (VoidPtr)((UIntPtr)zone->_start_addr + offset_);
+}
+
+// growable zones ------------------------------------------------------- //
+
+VYTAL_INLINE VoidPtr _memory_zone_bump_chunk(MemoryZone *zone, MemoryZoneChunk *chunk, const ByteSize size) {
+    BytePtr payload_ = (BytePtr)chunk + CHUNK_HEADER_SIZE;
 
+    if (!VYTAL_BITFLAG_IF_SET(zone->_flags, MEMORY_ZONE_FLAG_CONCURRENT)) {
+        if (chunk->_bump_offset + size > chunk->_capacity) return NULL;
+
+        VoidPtr ptr_ = payload_ + chunk->_bump_offset;
+        chunk->_bump_offset += size;
+        return ptr_;
+    }
+
+    ByteSize offset_ = __atomic_load_n(&chunk->_bump_offset, __ATOMIC_RELAXED);
+    do {
+        if (offset_ + size > chunk->_capacity) return NULL;
+    } while (!__atomic_compare_exchange_n(&chunk->_bump_offset, &offset_, offset_ + size, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED));
+
+    return payload_ + offset_;
+}
+
+// chains a chunk as large as everything the zone holds so far, so the total doubles each time
+MemoryZoneResult _memory_zone_grow(MemoryZone *zone, const ByteSize size) {
+    ByteSize total_    = zone->_capacity + zone->_grown_capacity;
+    ByteSize charged_  = _memory_zone_charged_capacity(zone);
+    ByteSize capacity_ = (total_ > size) ? total_ : size;
+
+    if (zone->_max_capacity) {
+        if (charged_ + size > zone->_max_capacity) return MEMORY_ZONE_ERROR_INSUFFICIENT_MEMORY;
+        if (charged_ + capacity_ > zone->_max_capacity) capacity_ = zone->_max_capacity - charged_;
+    }
+
+    ByteSize chunk_size_ = VYTAL_APPLY_ALIGNMENT(CHUNK_HEADER_SIZE + capacity_, MEMORY_ZONE_COMMIT_GRANULARITY(zone->_flags));
+    VoidPtr  addr_       = NULL;
+
+    if (platform_memory_reserve(chunk_size_, VYTAL_BITFLAG_IF_SET(zone->_flags, MEMORY_ZONE_FLAG_HUGE_PAGES), &addr_) != PLATFORM_MEMORY_SUCCESS)
+        return MEMORY_ZONE_ERROR_MEMORY_ALLOCATION;
+
+    if (platform_memory_commit(addr_, chunk_size_) != PLATFORM_MEMORY_SUCCESS) {
+        platform_memory_release(addr_, chunk_size_);
+        return MEMORY_ZONE_ERROR_MEMORY_ALLOCATION;
+    }
+
+    MemoryZoneChunk *chunk_ = (MemoryZoneChunk *)addr_;
+    chunk_->_next           = zone->_chunks;
+    chunk_->_size           = chunk_size_;
+    chunk_->_capacity       = capacity_;
+    chunk_->_bump_offset    = 0;
+
+    zone->_grown_capacity += capacity_;
+    if (zone->_capacity + zone->_grown_capacity > zone->_peak_capacity)
+        zone->_peak_capacity = zone->_capacity + zone->_grown_capacity;
+
+    __atomic_store_n(&zone->_chunks, chunk_, __ATOMIC_RELEASE);
     return MEMORY_ZONE_SUCCESS;
 }
 
-MemoryZoneResult memory_zone_allocate(ConstStr zone_name, const ByteSize size, VoidPtr *out_ptr, ByteSize *out_alloc_size) {
-    if (!zone_name || !size || !out_ptr) return MEMORY_ZONE_ERROR_INVALID_PARAM;
+VoidPtr _memory_zone_bump_growable(MemoryZone *zone, const ByteSize size) {
+    for (;;) {
+        MemoryZoneChunk *chunk_ = __atomic_load_n(&zone->_chunks, __ATOMIC_ACQUIRE);
+        if (chunk_) {
+            VoidPtr ptr_ = _memory_zone_bump_chunk(zone, chunk_, size);
+            if (ptr_) return ptr_;
+        }
+
+        // the first thread to find the newest chunk full chains the next one, the others retry on it
+        _memory_zone_lock(&zone->_grow_lock);
+        Bool grown_ = (zone->_chunks != chunk_) || (_memory_zone_grow(zone, size) == MEMORY_ZONE_SUCCESS);
+        _memory_zone_unlock(&zone->_grow_lock);
+
+        if (!grown_) return NULL;
+    }
+}
+
+VYTAL_INLINE void _memory_zone_add_used(MemoryZone *zone, const ByteSize delta) {
+    if (VYTAL_BITFLAG_IF_SET(zone->_flags, MEMORY_ZONE_FLAG_CONCURRENT))
+        __atomic_add_fetch(&zone->_used_memory, delta, __ATOMIC_RELAXED);
+    else
+        zone->_used_memory += delta;
+}
 
-    MemoryZone      *zone_;
-    MemoryZoneResult get_zone_ = memory_zone_get(zone_name, &zone_);
-    if (get_zone_ != MEMORY_ZONE_SUCCESS) return get_zone_;
+// blocks past the last size class get a chunk of their own, counted against the growth cap
+// and handed back to the system as soon as they are freed
+MemoryZoneResult _memory_zone_allocate_oversized(MemoryZone *zone, const ByteSize size, VoidPtr *out_ptr, ByteSize *out_alloc_size, Bool *out_fresh) {
+    ByteSize chunk_size_ = VYTAL_APPLY_ALIGNMENT(CHUNK_HEADER_SIZE + size, MEMORY_ZONE_COMMIT_GRANULARITY(zone->_flags));
+    ByteSize capacity_   = chunk_size_ - CHUNK_HEADER_SIZE;
+    VoidPtr  addr_       = NULL;
 
-    ByteSize             index_      = _memory_zone_get_size_class_index(zone_, size);
-    MemoryZoneSizeClass *size_class_ = &zone_->_size_classes[index_];
+    _memory_zone_lock(&zone->_grow_lock);
 
-    if (zone_->_used_memory + size_class_->_size > zone_->_capacity)
+    if (zone->_max_capacity && (_memory_zone_charged_capacity(zone) + capacity_ > zone->_max_capacity)) {
+        _memory_zone_unlock(&zone->_grow_lock);
         return MEMORY_ZONE_ERROR_INSUFFICIENT_MEMORY;
+    }
+
+    if (platform_memory_reserve(chunk_size_, VYTAL_BITFLAG_IF_SET(zone->_flags, MEMORY_ZONE_FLAG_HUGE_PAGES), &addr_) != PLATFORM_MEMORY_SUCCESS) {
+        _memory_zone_unlock(&zone->_grow_lock);
+        return MEMORY_ZONE_ERROR_MEMORY_ALLOCATION;
+    }
+
+    if (platform_memory_commit(addr_, chunk_size_) != PLATFORM_MEMORY_SUCCESS) {
+        platform_memory_release(addr_, chunk_size_);
+        _memory_zone_unlock(&zone->_grow_lock);
+        return MEMORY_ZONE_ERROR_MEMORY_ALLOCATION;
+    }
+
+    MemoryZoneChunk *chunk_ = (MemoryZoneChunk *)addr_;
+    chunk_->_next           = zone->_oversized_chunks;
+    chunk_->_size           = chunk_size_;
+    chunk_->_capacity       = capacity_;
+    chunk_->_bump_offset    = capacity_;
+
+    zone->_oversized_chunks = chunk_;
+    zone->_grown_capacity += capacity_;
+    if (zone->_capacity + zone->_grown_capacity > zone->_peak_capacity)
+        zone->_peak_capacity = zone->_capacity + zone->_grown_capacity;
+
+    _memory_zone_unlock(&zone->_grow_lock);
+
+    _memory_zone_add_used(zone, capacity_);
+
+    *out_ptr   = (BytePtr)addr_ + CHUNK_HEADER_SIZE;
+    *out_fresh = true;
+    if (out_alloc_size)
+        *out_alloc_size = capacity_;
 
-    // if free block of fitting size is found
-    if ((size_class_->_capacity > 0) && (size_class_->_num_blocks > 0)) {
-        *out_ptr = size_class_->_blocks[--size_class_->_num_blocks];
+    return MEMORY_ZONE_SUCCESS;
+}
+
+MemoryZoneResult _memory_zone_deallocate_oversized(MemoryZone *zone, const VoidPtr ptr) {
+    MemoryZoneChunk *chunk_ = (MemoryZoneChunk *)((BytePtr)ptr - CHUNK_HEADER_SIZE);
+
+    _memory_zone_lock(&zone->_grow_lock);
+
+    MemoryZoneChunk **link_ = &zone->_oversized_chunks;
+    while (*link_ && (*link_ != chunk_)) link_ = &(*link_)->_next;
+
+    if (!*link_) {
+        _memory_zone_unlock(&zone->_grow_lock);
+        return MEMORY_ZONE_ERROR_INVALID_POINTER;
+    }
+
+    *link_ = chunk_->_next;
+    zone->_grown_capacity -= chunk_->_capacity;
+
+    _memory_zone_unlock(&zone->_grow_lock);
+
+    _memory_zone_add_used(zone, (ByteSize)0 - chunk_->_capacity);
+
+    if (platform_memory_release(chunk_, chunk_->_size) != PLATFORM_MEMORY_SUCCESS)
+        return MEMORY_ZONE_ERROR_MEMORY_ALLOCATION;
+
+    return MEMORY_ZONE_SUCCESS;
+}
+
+VYTAL_INLINE Bool _memory_zone_oversized(MemoryZone *zone, const ByteSize size) {
+    return VYTAL_BITFLAG_IF_SET(zone->_flags, MEMORY_ZONE_FLAG_GROWABLE) && (size > zone->_size_classes[zone->_num_classes - 1]._size);
+}
+
+// ---------------------------------------------------------------------- //
+
+// fresh memory has never been handed out before, so it is still zero
+VYTAL_INLINE VoidPtr _memory_zone_bump(MemoryZone *zone, const ByteSize size, Bool *out_fresh) {
+    VoidPtr ptr_ = _memory_zone_bump_region(zone, size);
+    if (ptr_) {
+        *out_fresh = ((UIntPtr)ptr_ - (UIntPtr)zone->_start_addr) >= zone->_dirty_offset;
+        return ptr_;
+    }
+
+    // chunks are mapped on demand and dropped on clear, so they are always fresh
+    *out_fresh = true;
+    if (!VYTAL_BITFLAG_IF_SET(zone->_flags, MEMORY_ZONE_FLAG_GROWABLE)) return NULL;
+
+    // the leftover of the zone's own region stays unused; freed blocks still land in its free lists
+    return _memory_zone_bump_growable(zone, size);
+}
+
+VYTAL_INLINE void _memory_zone_raise_to(ByteSize *peak, const ByteSize value) {
+    ByteSize peak_ = __atomic_load_n(peak, __ATOMIC_RELAXED);
+    while ((value > peak_) && !__atomic_compare_exchange_n(peak, &peak_, value, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED));
+}
+
+VYTAL_INLINE void _memory_zone_track_peak(MemoryZone *zone) {
+    _memory_zone_raise_to(&zone->_peak_used_memory, __atomic_load_n(&zone->_used_memory, __ATOMIC_RELAXED));
+}
+
+// gives the block back to the bump pointer if it is the last one handed out
+VYTAL_INLINE Bool _memory_zone_release_tail(MemoryZone *zone, const VoidPtr ptr, const ByteSize size) {
+    if ((UIntPtr)ptr < (UIntPtr)zone->_start_addr) return false;
+
+    ByteSize offset_ = (UIntPtr)ptr - (UIntPtr)zone->_start_addr;
+    if (offset_ + size != zone->_bump_offset) return false;
+
+    if (zone->_bump_offset > zone->_dirty_offset)
+        zone->_dirty_offset = zone->_bump_offset;
+
+    zone->_bump_offset = offset_;
+    return true;
+}
+
+VYTAL_INLINE void _memory_zone_push_free_block(MemoryZoneSizeClass *size_class, const VoidPtr ptr) {
+    MemoryZoneFreeBlock *block_ = (MemoryZoneFreeBlock *)ptr;
+
+    block_->_next = size_class->_free_list;
+    block_->_prev = NULL;
+    if (block_->_next) block_->_next->_prev = block_;
+
+    size_class->_free_list = block_;
+    ++size_class->_num_blocks;
+}
+
+VYTAL_INLINE VoidPtr _memory_zone_pop_free_block(MemoryZoneSizeClass *size_class) {
+    MemoryZoneFreeBlock *block_ = size_class->_free_list;
+    if (!block_) return NULL;
+
+    size_class->_free_list = block_->_next;
+    if (block_->_next) block_->_next->_prev = NULL;
+
+    --size_class->_num_blocks;
+    return block_;
+}
+
+VYTAL_INLINE void _memory_zone_unlink_free_block(MemoryZoneSizeClass *size_class, MemoryZoneFreeBlock *block) {
+    if (block->_prev)
+        block->_prev->_next = block->_next;
+    else
+        size_class->_free_list = block->_next;
+
+    if (block->_next) block->_next->_prev = block->_prev;
+    --size_class->_num_blocks;
+}
+
+// coalescing zones ----------------------------------------------------- //
+
+// largest class not bigger than size; free blocks of any size are filed here
+ByteSize _memory_zone_get_floor_class_index(MemoryZone *zone, const ByteSize size) {
+    ByteSize index_ = _memory_zone_get_size_class_index(zone, size);
+    return index_ - ((index_ > 0) && (zone->_size_classes[index_]._size > size));
+}
+
+VYTAL_INLINE MemoryZoneBlockTag *_memory_zone_block_tag_at(MemoryZone *zone, const ByteSize offset) {
+    return (MemoryZoneBlockTag *)((UIntPtr)zone->_start_addr + offset);
+}
+
+VYTAL_INLINE ByteSize _memory_zone_block_tag_offset(MemoryZone *zone, MemoryZoneBlockTag *tag) {
+    return (UIntPtr)tag - (UIntPtr)zone->_start_addr;
+}
+
+void _memory_zone_file_free_block(MemoryZone *zone, MemoryZoneBlockTag *tag, const ByteSize size) {
+    tag->_size = size | BLOCK_FREE_BIT;
+
+    ByteSize next_offset_ = _memory_zone_block_tag_offset(zone, tag) + size;
+    if (next_offset_ < zone->_bump_offset)
+        _memory_zone_block_tag_at(zone, next_offset_)->_prev_size = size;
+
+    _memory_zone_push_free_block(&zone->_size_classes[_memory_zone_get_floor_class_index(zone, size)], (BytePtr)tag + BLOCK_TAG_SIZE);
+}
+
+VYTAL_INLINE void _memory_zone_unfile_free_block(MemoryZone *zone, MemoryZoneBlockTag *tag) {
+    ByteSize size_ = tag->_size & ~BLOCK_FREE_BIT;
+    _memory_zone_unlink_free_block(&zone->_size_classes[_memory_zone_get_floor_class_index(zone, size_)], (MemoryZoneFreeBlock *)((BytePtr)tag + BLOCK_TAG_SIZE));
+}
+
+MemoryZoneResult _memory_zone_allocate_coalescing(MemoryZone *zone, const ByteSize size, VoidPtr *out_ptr, ByteSize *out_alloc_size, Bool *out_fresh) {
+    ByteSize index_      = _memory_zone_get_size_class_index(zone, size + BLOCK_TAG_SIZE);
+    ByteSize block_size_ = zone->_size_classes[index_]._size;
+    if (block_size_ < size + BLOCK_TAG_SIZE) return MEMORY_ZONE_ERROR_INSUFFICIENT_MEMORY;
+
+    // first fit over this class and the larger ones
+    MemoryZoneBlockTag *tag_ = NULL;
+    for (ByteSize i = index_; i < zone->_num_classes && !tag_; ++i) {
+        VoidPtr free_ = _memory_zone_pop_free_block(&zone->_size_classes[i]);
+        if (free_) tag_ = (MemoryZoneBlockTag *)((BytePtr)free_ - BLOCK_TAG_SIZE);
+    }
+
+    if (tag_) {
+        *out_fresh = false;
+
+        ByteSize found_size_ = tag_->_size & ~BLOCK_FREE_BIT;
+        tag_->_size          = found_size_;
+
+        // split off the remainder if it still makes a usable block
+        ByteSize remainder_ = found_size_ - block_size_;
+        if (remainder_ >= zone->_size_classes[1]._size + BLOCK_TAG_SIZE) {
+            tag_->_size = block_size_;
+
+            MemoryZoneBlockTag *rest_ = (MemoryZoneBlockTag *)((BytePtr)tag_ + block_size_);
+            rest_->_prev_size         = block_size_;
+            _memory_zone_file_free_block(zone, rest_, remainder_);
+        }
+    }
 
-        if (out_alloc_size)
-            *out_alloc_size = size_class_->_size;
+    // otherwise, allocate from zone memory
+    else {
+        if (!(tag_ = _memory_zone_bump(zone, block_size_, out_fresh)))
+            return MEMORY_ZONE_ERROR_INSUFFICIENT_MEMORY;
+
+        tag_->_size      = block_size_;
+        tag_->_prev_size = zone->_tail_size;
+        zone->_tail_size = block_size_;
+    }
+
+    zone->_used_memory += tag_->_size;
+
+    *out_ptr = (BytePtr)tag_ + BLOCK_TAG_SIZE;
+    if (out_alloc_size)
+        *out_alloc_size = tag_->_size - BLOCK_TAG_SIZE;
+
+    return MEMORY_ZONE_SUCCESS;
+}
+
+MemoryZoneResult _memory_zone_deallocate_coalescing(MemoryZone *zone, const VoidPtr ptr) {
+    MemoryZoneBlockTag *tag_  = (MemoryZoneBlockTag *)((BytePtr)ptr - BLOCK_TAG_SIZE);
+    ByteSize            size_ = tag_->_size;
+
+    if (size_ & BLOCK_FREE_BIT) return MEMORY_ZONE_ERROR_INVALID_POINTER;
+    zone->_used_memory -= size_;
+
+    // merge with the following block
+    ByteSize next_offset_ = _memory_zone_block_tag_offset(zone, tag_) + size_;
+    if (next_offset_ < zone->_bump_offset) {
+        MemoryZoneBlockTag *next_ = _memory_zone_block_tag_at(zone, next_offset_);
+
+        if (next_->_size & BLOCK_FREE_BIT) {
+            _memory_zone_unfile_free_block(zone, next_);
+            size_ += next_->_size & ~BLOCK_FREE_BIT;
+        }
+    }
+
+    // merge with the preceding block
+    if (tag_->_prev_size) {
+        MemoryZoneBlockTag *prev_ = (MemoryZoneBlockTag *)((BytePtr)tag_ - tag_->_prev_size);
+
+        if (prev_->_size & BLOCK_FREE_BIT) {
+            _memory_zone_unfile_free_block(zone, prev_);
+            size_ += prev_->_size & ~BLOCK_FREE_BIT;
+            tag_ = prev_;
+        }
+    }
+
+    // the merged block reaches the bump pointer, so hand the tail back
+    if (_memory_zone_release_tail(zone, tag_, size_)) {
+        zone->_tail_size = tag_->_prev_size;
+        return MEMORY_ZONE_SUCCESS;
+    }
+
+    _memory_zone_file_free_block(zone, tag_, size_);
+    return MEMORY_ZONE_SUCCESS;
+}
 
-        zone_->_used_memory += size_class_->_size;
+// concurrent zones ----------------------------------------------------- //
 
+MemoryZoneResult _memory_zone_allocate_concurrent(MemoryZone *zone, const ByteSize index, VoidPtr *out_ptr, Bool *out_fresh) {
+    MemoryZoneSizeClass *size_class_ = &zone->_size_classes[index];
+    MemoryZoneMagazine  *magazine_   = _memory_zone_get_magazine(zone, index);
+
+    *out_fresh = false;
+
+    // thread-local hit, no synchronization needed
+    if (magazine_ && magazine_->_num_blocks > 0) {
+        *out_ptr = magazine_->_blocks[--magazine_->_num_blocks];
         return MEMORY_ZONE_SUCCESS;
     }
 
+    // refill half a magazine from the shared free list
+    {
+        _memory_zone_lock(&size_class_->_lock);
+
+        if (magazine_) {
+            while ((size_class_->_free_list) && (magazine_->_num_blocks < MEMORY_ZONE_MAGAZINE_SIZE / 2))
+                magazine_->_blocks[magazine_->_num_blocks++] = _memory_zone_pop_free_block(size_class_);
+
+            *out_ptr = (magazine_->_num_blocks > 0) ? magazine_->_blocks[--magazine_->_num_blocks] : NULL;
+        } else
+            *out_ptr = _memory_zone_pop_free_block(size_class_);
+
+        _memory_zone_unlock(&size_class_->_lock);
+        if (*out_ptr) return MEMORY_ZONE_SUCCESS;
+    }
+
     // otherwise, allocate from zone memory
+    *out_ptr = _memory_zone_bump(zone, size_class_->_size, out_fresh);
+    return (*out_ptr) ? MEMORY_ZONE_SUCCESS : MEMORY_ZONE_ERROR_INSUFFICIENT_MEMORY;
+}
+
+void _memory_zone_deallocate_concurrent(MemoryZone *zone, const ByteSize index, const VoidPtr ptr) {
+    MemoryZoneSizeClass *size_class_ = &zone->_size_classes[index];
+    MemoryZoneMagazine  *magazine_   = _memory_zone_get_magazine(zone, index);
+
+    // thread-local hit, no synchronization needed
+    if (magazine_ && magazine_->_num_blocks < MEMORY_ZONE_MAGAZINE_SIZE) {
+        magazine_->_blocks[magazine_->_num_blocks++] = ptr;
+        return;
+    }
+
+    // flush half of the magazine (or the block itself) to the shared free list
     {
-        *out_ptr = (VoidPtr)((UIntPtr)zone_->_start_addr + zone_->_used_memory);
+        _memory_zone_lock(&size_class_->_lock);
 
-        if (out_alloc_size)
-            *out_alloc_size = size_class_->_size;
+        if (magazine_) {
+            while (magazine_->_num_blocks > MEMORY_ZONE_MAGAZINE_SIZE / 2)
+                _memory_zone_push_free_block(size_class_, magazine_->_blocks[--magazine_->_num_blocks]);
+        } else
+            _memory_zone_push_free_block(size_class_, ptr);
 
-        zone_->_used_memory += size_class_->_size;
+        _memory_zone_unlock(&size_class_->_lock);
     }
 
-    return MEMORY_ZONE_SUCCESS;
+    if (magazine_)
+        magazine_->_blocks[magazine_->_num_blocks++] = ptr;
 }
 
-MemoryZoneResult memory_zone_deallocate(ConstStr zone_name, const VoidPtr ptr, const ByteSize size) {
-    if (!zone_name || !ptr || !size) return MEMORY_ZONE_ERROR_INVALID_PARAM;
+// ---------------------------------------------------------------------- //
 
-    MemoryZone      *zone_;
-    MemoryZoneResult get_zone_ = memory_zone_get(zone_name, &zone_);
-    if (get_zone_ != MEMORY_ZONE_SUCCESS) return get_zone_;
+MemoryZoneResult _memory_zone_allocate_general(MemoryZone *zone, const ByteSize size, VoidPtr *out_ptr, ByteSize *out_alloc_size, Bool *out_fresh) {
+    if (_memory_zone_oversized(zone, size))
+        return _memory_zone_allocate_oversized(zone, size, out_ptr, out_alloc_size, out_fresh);
 
-    const float ratio_ = 1.618f;
+    ByteSize             index_      = _memory_zone_get_size_class_index(zone, size);
+    MemoryZoneSizeClass *size_class_ = &zone->_size_classes[index_];
+    if (size_class_->_size < size) return MEMORY_ZONE_ERROR_INSUFFICIENT_MEMORY;
 
-    ByteSize             index_      = _memory_zone_get_size_class_index(zone_, size);
-    MemoryZoneSizeClass *size_class_ = &zone_->_size_classes[index_];
+    if (VYTAL_BITFLAG_IF_SET(zone->_flags, MEMORY_ZONE_FLAG_CONCURRENT)) {
+        MemoryZoneResult allocate_ = _memory_zone_allocate_concurrent(zone, index_, out_ptr, out_fresh);
+        if (allocate_ != MEMORY_ZONE_SUCCESS)
+            return allocate_;
 
-    if (size_class_->_num_blocks == size_class_->_capacity) {
-        ByteSize new_capacity_ = !size_class_->_capacity ? CONTAINER_DEFAULT_CAPACITY : (ByteSize)((Flt32)size_class_->_capacity * ratio_);
+        __atomic_add_fetch(&zone->_used_memory, size_class_->_size, __ATOMIC_RELAXED);
+    }
 
-        VoidPtr *new_blocks_ = realloc(size_class_->_blocks, sizeof(VoidPtr) * new_capacity_);
-        if (!new_blocks_)
-            return MEMORY_ZONE_ERROR_MEMORY_ALLOCATION;
+    else {
+        // if free block of fitting size is found
+        if (size_class_->_free_list) {
+            *out_ptr   = _memory_zone_pop_free_block(size_class_);
+            *out_fresh = false;
+        }
+
+        // otherwise, allocate from zone memory
+        else if (!(*out_ptr = _memory_zone_bump(zone, size_class_->_size, out_fresh)))
+            return MEMORY_ZONE_ERROR_INSUFFICIENT_MEMORY;
 
-        size_class_->_blocks   = new_blocks_;
-        size_class_->_capacity = new_capacity_;
+        zone->_used_memory += size_class_->_size;
     }
 
-    size_class_->_blocks[size_class_->_num_blocks++] = ptr;
-    zone_->_used_memory -= size_class_->_size;
+    if (out_alloc_size)
+        *out_alloc_size = size_class_->_size;
 
     return MEMORY_ZONE_SUCCESS;
 }
 
-void memory_zone_compute_size_classes(ByteSize *out_num_classes, MemoryZoneSizeClass **out_size_classes, const ByteSize capacity) {
-    _memory_zone_compute_size_classes(out_num_classes, out_size_classes, capacity);
+// statistics ----------------------------------------------------------- //
+
+#if defined(VYTAL_MEMORY_STATS)
+// counters are shared between threads only in concurrent zones
+VYTAL_INLINE ByteSize _memory_zone_count(MemoryZone *zone, ByteSize *counter, const ByteSize delta) {
+    if (VYTAL_BITFLAG_IF_SET(zone->_flags, MEMORY_ZONE_FLAG_CONCURRENT))
+        return __atomic_add_fetch(counter, delta, __ATOMIC_RELAXED);
+
+    return *counter += delta;
+}
+
+// delta is the requested size: negated (modulo 2^64) for deallocations
+void _memory_zone_record(MemoryZone *zone, const ByteSize size, const ByteSize alignment, const Bool allocated) {
+    ByteSize delta_ = allocated ? size : (ByteSize)0 - size;
+    ByteSize one_   = allocated ? 1 : (ByteSize)0 - 1;
+
+    _memory_zone_count(zone, allocated ? &zone->_num_allocations : &zone->_num_deallocations, 1);
+
+    // arenas and stacks drop blocks without deallocating them, so only their counts are kept
+    if ((zone->_type == MEMORY_ZONE_TYPE_GENERAL) || (zone->_type == MEMORY_ZONE_TYPE_POOL))
+        _memory_zone_count(zone, &zone->_requested_memory, delta_);
+
+    if (zone->_type != MEMORY_ZONE_TYPE_GENERAL) return;
+
+    // the class the block actually came from, padding included
+    ByteSize padded_ = size;
+
+#    if defined(VYTAL_MEMORY_DEBUG)
+    if (_memory_zone_debug_guarded(zone, size)) return;
+    padded_ += _memory_zone_debug_header_size(zone, alignment) + DEBUG_CANARY_SIZE;
+#    endif
+
+    if (alignment > MEMORY_ALIGNMENT_SIZE) padded_ += alignment;
+    if (VYTAL_BITFLAG_IF_SET(zone->_flags, MEMORY_ZONE_FLAG_COALESCE)) padded_ += BLOCK_TAG_SIZE;
+    if (_memory_zone_oversized(zone, padded_)) return;
+
+    MemoryZoneSizeClass *size_class_ = &zone->_size_classes[_memory_zone_get_size_class_index(zone, padded_)];
+
+    _memory_zone_count(zone, allocated ? &size_class_->_num_allocations : &size_class_->_num_deallocations, 1);
+    _memory_zone_count(zone, &size_class_->_requested_memory, delta_);
+    _memory_zone_raise_to(&size_class_->_peak_blocks, _memory_zone_count(zone, &size_class_->_live_blocks, one_));
+}
+#endif
+
+#if defined(VYTAL_MEMORY_TRACK_CALLSITES)
+void _memory_zone_record_callsite(const MemoryZoneHandle handle, const ByteSize size) {
+    if (!callsite_file) return;
+
+    UIntPtr  hash_  = ((UIntPtr)callsite_file ^ ((UIntPtr)callsite_line * 0x9e3779b97f4a7c15ull));
+    ByteSize index_ = (ByteSize)(hash_ % MEMORY_ZONE_CALLSITE_SLOTS);
+
+    _memory_zone_lock(&callsites_lock);
+
+    for (ByteSize i = 0; i < MEMORY_ZONE_CALLSITE_SLOTS; ++i) {
+        MemoryZoneCallsiteStats *callsite_ = &callsites[(index_ + i) % MEMORY_ZONE_CALLSITE_SLOTS];
+
+        if (!callsite_->_file) {
+            callsite_->_file = callsite_file;
+            callsite_->_line = callsite_line;
+            callsite_->_zone = handle;
+        } else if ((callsite_->_file != callsite_file) || (callsite_->_line != callsite_line))
+            continue;
+
+        ++callsite_->_num_allocations;
+        callsite_->_allocated_memory += size;
+        break;
+    }
+
+    _memory_zone_unlock(&callsites_lock);
+    callsite_file = NULL;
+}
+
+void memory_zone_tag_callsite(ConstStr file, const Int32 line) {
+    callsite_file = file;
+    callsite_line = line;
+}
+#endif
+
+// ---------------------------------------------------------------------- //
+
+// over-allocates by the alignment and keeps the block address right below the aligned pointer,
+// so the padding costs one class step at most instead of a class per alignment
+MemoryZoneResult _memory_zone_allocate_offset(MemoryZone *zone, const ByteSize size, const ByteSize alignment, VoidPtr *out_ptr, ByteSize *out_alloc_size, Bool *out_fresh) {
+    VoidPtr  block_      = NULL;
+    ByteSize block_size_ = 0;
+
+    MemoryZoneResult allocate_ = VYTAL_BITFLAG_IF_SET(zone->_flags, MEMORY_ZONE_FLAG_COALESCE)
+                                     ? _memory_zone_allocate_coalescing(zone, size + alignment, &block_, &block_size_, out_fresh)
+                                     : _memory_zone_allocate_general(zone, size + alignment, &block_, &block_size_, out_fresh);
+    if (allocate_ != MEMORY_ZONE_SUCCESS)
+        return allocate_;
+
+    UIntPtr aligned_ = VYTAL_APPLY_ALIGNMENT((UIntPtr)block_ + sizeof(VoidPtr), alignment);
+    ((VoidPtr *)aligned_)[-1] = block_;
+
+    *out_ptr = (VoidPtr)aligned_;
+    if (out_alloc_size)
+        *out_alloc_size = block_size_ - (aligned_ - (UIntPtr)block_);
+
+    return MEMORY_ZONE_SUCCESS;
+}
+
+MemoryZoneResult _memory_zone_deallocate_general(MemoryZone *zone, const VoidPtr ptr, const ByteSize size) {
+    if (VYTAL_BITFLAG_IF_SET(zone->_flags, MEMORY_ZONE_FLAG_COALESCE))
+        return _memory_zone_deallocate_coalescing(zone, ptr);
+
+    if (_memory_zone_oversized(zone, size))
+        return _memory_zone_deallocate_oversized(zone, ptr);
+
+    ByteSize             index_      = _memory_zone_get_size_class_index(zone, size);
+    MemoryZoneSizeClass *size_class_ = &zone->_size_classes[index_];
+
+    if (VYTAL_BITFLAG_IF_SET(zone->_flags, MEMORY_ZONE_FLAG_CONCURRENT)) {
+        _memory_zone_deallocate_concurrent(zone, index_, ptr);
+        __atomic_sub_fetch(&zone->_used_memory, size_class_->_size, __ATOMIC_RELAXED);
+        return MEMORY_ZONE_SUCCESS;
+    }
+
+    if (!_memory_zone_release_tail(zone, ptr, size_class_->_size))
+        _memory_zone_push_free_block(size_class_, ptr);
+
+    zone->_used_memory -= size_class_->_size;
+    return MEMORY_ZONE_SUCCESS;
+}
+
+MemoryZoneResult _memory_zone_allocate_block(MemoryZone *zone, const ByteSize size, const ByteSize alignment, VoidPtr *out_ptr, ByteSize *out_alloc_size, Bool *out_fresh) {
+    switch (zone->_type) {
+        case MEMORY_ZONE_TYPE_FRAME_ARENA:
+            return memory_zone_frame_arena_allocate(zone, size, alignment, out_ptr, out_alloc_size);
+
+        case MEMORY_ZONE_TYPE_STACK:
+            return memory_zone_stack_allocate(zone, size, alignment, out_ptr, out_alloc_size);
+
+        // slots sit where the layout puts them, so they either all satisfy the alignment or none does
+        case MEMORY_ZONE_TYPE_POOL:
+            if (((UIntPtr)zone->_start_addr | zone->_pool._slot_size) & (alignment - 1))
+                return MEMORY_ZONE_ERROR_INVALID_PARAM;
+
+            return memory_zone_pool_allocate(zone, size, out_ptr, out_alloc_size);
+
+        default:
+            if (alignment > MEMORY_ALIGNMENT_SIZE)
+                return _memory_zone_allocate_offset(zone, size, alignment, out_ptr, out_alloc_size, out_fresh);
+
+            if (VYTAL_BITFLAG_IF_SET(zone->_flags, MEMORY_ZONE_FLAG_COALESCE))
+                return _memory_zone_allocate_coalescing(zone, size, out_ptr, out_alloc_size, out_fresh);
+
+            return _memory_zone_allocate_general(zone, size, out_ptr, out_alloc_size, out_fresh);
+    }
+}
+
+MemoryZoneResult _memory_zone_deallocate_block(MemoryZone *zone, const VoidPtr ptr, const ByteSize size, const ByteSize alignment) {
+    switch (zone->_type) {
+        // frame data is dropped wholesale when the frame advances
+        case MEMORY_ZONE_TYPE_FRAME_ARENA:
+            return MEMORY_ZONE_SUCCESS;
+
+        case MEMORY_ZONE_TYPE_STACK:
+            return memory_zone_stack_deallocate(zone, ptr, size);
+
+        case MEMORY_ZONE_TYPE_POOL:
+            return memory_zone_pool_deallocate(zone, ptr);
+
+        default:
+            if (alignment > MEMORY_ALIGNMENT_SIZE)
+                return _memory_zone_deallocate_general(zone, ((VoidPtr *)ptr)[-1], size + alignment);
+
+            return _memory_zone_deallocate_general(zone, ptr, size);
+    }
+}
+
+// the block is the last one carved off the zone's own region when its class ends at the bump pointer;
+// arenas, stacks and pools have no classes, concurrent zones move the bump pointer under us and
+// coalescing zones would have to retag the neighbours
+MemoryZoneResult _memory_zone_extend_block(MemoryZone *zone, const VoidPtr block, const ByteSize size, const ByteSize new_size, ByteSize *out_alloc_size) {
+    if (zone->_type != MEMORY_ZONE_TYPE_GENERAL) return MEMORY_ZONE_ERROR_INSUFFICIENT_MEMORY;
+    if (VYTAL_BITFLAG_IF_SET(zone->_flags, MEMORY_ZONE_FLAG_CONCURRENT | MEMORY_ZONE_FLAG_COALESCE)) return MEMORY_ZONE_ERROR_INSUFFICIENT_MEMORY;
+    if ((UIntPtr)block < (UIntPtr)zone->_start_addr) return MEMORY_ZONE_ERROR_INSUFFICIENT_MEMORY;
+    if (_memory_zone_oversized(zone, size)) return MEMORY_ZONE_ERROR_INSUFFICIENT_MEMORY;
+
+    MemoryZoneSizeClass *size_class_     = &zone->_size_classes[_memory_zone_get_size_class_index(zone, size)];
+    MemoryZoneSizeClass *new_size_class_ = &zone->_size_classes[_memory_zone_get_size_class_index(zone, new_size)];
+    if (new_size_class_->_size < new_size) return MEMORY_ZONE_ERROR_INSUFFICIENT_MEMORY;
+
+    ByteSize offset_ = (UIntPtr)block - (UIntPtr)zone->_start_addr;
+    if (offset_ + size_class_->_size != zone->_bump_offset) return MEMORY_ZONE_ERROR_INSUFFICIENT_MEMORY;
+    if (offset_ + new_size_class_->_size > _memory_zone_region_limit(zone)) return MEMORY_ZONE_ERROR_INSUFFICIENT_MEMORY;
+
+    if (memory_zone_ensure_committed(zone, offset_ + new_size_class_->_size) != MEMORY_ZONE_SUCCESS)
+        return MEMORY_ZONE_ERROR_INSUFFICIENT_MEMORY;
+
+    zone->_bump_offset = offset_ + new_size_class_->_size;
+    zone->_used_memory += new_size_class_->_size - size_class_->_size;
+
+    if (out_alloc_size)
+        *out_alloc_size = new_size_class_->_size;
+
+    return MEMORY_ZONE_SUCCESS;
+}
+
+// debug builds --------------------------------------------------------- //
+
+#if defined(VYTAL_MEMORY_DEBUG)
+void _memory_zone_debug_link(MemoryZone *zone, const VoidPtr ptr, const ByteSize size) {
+    MemoryZoneDebugHeader *header_ = (MemoryZoneDebugHeader *)ptr - 1;
+
+    header_->_size   = size;
+    header_->_canary = DEBUG_CANARY;
+    header_->_prev   = NULL;
+    header_->_file   = NULL;
+    header_->_line   = 0;
+
+#    if defined(VYTAL_MEMORY_TRACK_CALLSITES)
+    header_->_file = callsite_file;
+    header_->_line = callsite_line;
+#    endif
+
+    // arenas and stacks drop their blocks without freeing them, so only general zones can leak
+    if (zone->_type != MEMORY_ZONE_TYPE_GENERAL) return;
+
+    _memory_zone_lock(&zone->_debug_lock);
+
+    header_->_next = zone->_debug_blocks;
+    if (header_->_next) header_->_next->_prev = header_;
+    zone->_debug_blocks = header_;
+
+    _memory_zone_unlock(&zone->_debug_lock);
+}
+
+void _memory_zone_debug_unlink(MemoryZone *zone, MemoryZoneDebugHeader *header) {
+    if (zone->_type != MEMORY_ZONE_TYPE_GENERAL) return;
+
+    _memory_zone_lock(&zone->_debug_lock);
+
+    if (header->_prev)
+        header->_prev->_next = header->_next;
+    else
+        zone->_debug_blocks = header->_next;
+
+    if (header->_next) header->_next->_prev = header->_prev;
+
+    _memory_zone_unlock(&zone->_debug_lock);
+}
+
+// the header goes first: a block freed twice no longer has one, and the trailing canary is only found through it
+MemoryZoneResult _memory_zone_debug_check(MemoryZone *zone, const VoidPtr ptr, const ByteSize size, const Bool guarded) {
+    MemoryZoneDebugHeader *header_ = (MemoryZoneDebugHeader *)ptr - 1;
+    ConstStr               error_  = NULL;
+    UInt64                 tail_   = DEBUG_CANARY;
+
+    if (header_->_canary != DEBUG_CANARY)
+        error_ = (header_->_canary == DEBUG_POISON_FREED * 0x0101010101010101ull) ? "freed twice" : "underrun or foreign pointer";
+    else if (header_->_size != size)
+        error_ = "freed with the wrong size";
+    else if (!guarded && (memcpy(&tail_, (BytePtr)ptr + size, DEBUG_CANARY_SIZE), tail_ != DEBUG_CANARY))
+        error_ = "overrun";
+
+    if (!error_) return MEMORY_ZONE_SUCCESS;
+
+    fprintf(stderr, "memory zone '%s': block %p (%zu bytes) %s\n", zone->_name, ptr, size, error_);
+    return MEMORY_ZONE_ERROR_CORRUPTED;
+}
+
+// charged up front and handed back if the zone has no room left for it
+Bool _memory_zone_debug_charge_guarded(MemoryZone *zone, const ByteSize size) {
+    ByteSize guarded_ = __atomic_add_fetch(&zone->_guarded_memory, size, __ATOMIC_RELAXED);
+    Bool     fits_    = true;
+
+    if (VYTAL_BITFLAG_IF_SET(zone->_flags, MEMORY_ZONE_FLAG_GROWABLE))
+        fits_ = !zone->_max_capacity || (zone->_capacity + zone->_grown_capacity + guarded_ <= zone->_max_capacity);
+    else
+        fits_ = __atomic_load_n(&zone->_bump_offset, __ATOMIC_RELAXED) + guarded_ <= zone->_capacity;
+
+    if (!fits_) __atomic_sub_fetch(&zone->_guarded_memory, size, __ATOMIC_RELAXED);
+    return fits_;
+}
+
+// large blocks get a mapping of their own, placed flush against an uncommitted granule so overruns fault
+MemoryZoneResult _memory_zone_debug_allocate_guarded(MemoryZone *zone, const ByteSize size, const ByteSize alignment, VoidPtr *out_ptr) {
+    ByteSize data_size_ = _memory_zone_debug_guarded_size(size, alignment);
+    VoidPtr  addr_      = NULL;
+
+    if (!_memory_zone_debug_charge_guarded(zone, data_size_))
+        return MEMORY_ZONE_ERROR_INSUFFICIENT_MEMORY;
+
+    if (platform_memory_reserve(data_size_ + MEMORY_ZONE_COMMIT_SIZE, false, &addr_) != PLATFORM_MEMORY_SUCCESS) {
+        __atomic_sub_fetch(&zone->_guarded_memory, data_size_, __ATOMIC_RELAXED);
+        return MEMORY_ZONE_ERROR_MEMORY_ALLOCATION;
+    }
+
+    if (platform_memory_commit(addr_, data_size_) != PLATFORM_MEMORY_SUCCESS) {
+        platform_memory_release(addr_, data_size_ + MEMORY_ZONE_COMMIT_SIZE);
+        __atomic_sub_fetch(&zone->_guarded_memory, data_size_, __ATOMIC_RELAXED);
+        return MEMORY_ZONE_ERROR_MEMORY_ALLOCATION;
+    }
+
+    *out_ptr = (BytePtr)addr_ + data_size_ - VYTAL_APPLY_ALIGNMENT(size, alignment);
+    _memory_zone_add_used(zone, data_size_);
+
+    MemoryZoneDebugHeader *header_ = (MemoryZoneDebugHeader *)*out_ptr - 1;
+    header_->_mapping              = addr_;
+    header_->_mapping_size         = data_size_ + MEMORY_ZONE_COMMIT_SIZE;
+
+    return MEMORY_ZONE_SUCCESS;
+}
+
+// the pages are decommitted and the range is parked in the quarantine, so late accesses keep faulting
+// until MEMORY_ZONE_GUARD_QUARANTINE more guarded blocks have been freed after it
+MemoryZoneResult _memory_zone_debug_deallocate_guarded(MemoryZone *zone, const VoidPtr ptr) {
+    MemoryZoneDebugHeader *header_  = (MemoryZoneDebugHeader *)ptr - 1;
+    MemoryZoneGuardRange   range_   = {header_->_mapping, header_->_mapping_size};
+    ByteSize               charged_ = range_._size - MEMORY_ZONE_COMMIT_SIZE;
+
+    if (platform_memory_decommit(range_._addr, charged_) != PLATFORM_MEMORY_SUCCESS)
+        return MEMORY_ZONE_ERROR_MEMORY_ALLOCATION;
+
+    _memory_zone_add_used(zone, (ByteSize)0 - charged_);
+    __atomic_sub_fetch(&zone->_guarded_memory, charged_, __ATOMIC_RELAXED);
+
+    _memory_zone_lock(&zone->_debug_lock);
+
+    MemoryZoneGuardRange *slot_   = &zone->_guard_quarantine[zone->_guard_quarantine_next];
+    MemoryZoneGuardRange  oldest_ = *slot_;
+
+    *slot_                       = range_;
+    zone->_guard_quarantine_next = (zone->_guard_quarantine_next + 1) % MEMORY_ZONE_GUARD_QUARANTINE;
+
+    _memory_zone_unlock(&zone->_debug_lock);
+
+    if (oldest_._addr) platform_memory_release(oldest_._addr, oldest_._size);
+    return MEMORY_ZONE_SUCCESS;
+}
+
+// blocks are carved as [header | payload | canary]; payloads start out poisoned unless zeroing was asked for
+MemoryZoneResult _memory_zone_debug_allocate(MemoryZone *zone, const ByteSize size, const ByteSize alignment, const Bool zeroed, VoidPtr *out_ptr, ByteSize *out_alloc_size) {
+    ByteSize header_size_ = _memory_zone_debug_header_size(zone, alignment);
+    Bool     guarded_     = _memory_zone_debug_guarded(zone, size);
+
+    MemoryZoneResult result_;
+    VoidPtr          block_      = NULL;
+    ByteSize         block_size_ = header_size_ ? header_size_ + size + DEBUG_CANARY_SIZE : size;
+    Bool             fresh_      = guarded_;
+
+    if (guarded_)
+        result_ = _memory_zone_debug_allocate_guarded(zone, size, alignment, out_ptr);
+    else if ((result_ = _memory_zone_allocate_block(zone, block_size_, alignment, &block_, &block_size_, &fresh_)) == MEMORY_ZONE_SUCCESS)
+        *out_ptr = (BytePtr)block_ + header_size_;
+
+    if (result_ != MEMORY_ZONE_SUCCESS) return result_;
+
+    if (zeroed && !fresh_)
+        memset(block_, 0, block_size_);
+    else if (!zeroed)
+        memset(*out_ptr, DEBUG_POISON_FRESH, size);
+
+    // the exact size is reported back, so callers that size their blocks by it never grow into the canary
+    if (header_size_) {
+        UInt64 canary_ = DEBUG_CANARY;
+        if (!guarded_) memcpy((BytePtr)*out_ptr + size, &canary_, DEBUG_CANARY_SIZE);
+
+        _memory_zone_debug_link(zone, *out_ptr, size);
+    }
+
+    if (out_alloc_size)
+        *out_alloc_size = size;
+
+    return MEMORY_ZONE_SUCCESS;
+}
+
+MemoryZoneResult _memory_zone_debug_deallocate(MemoryZone *zone, const VoidPtr ptr, const ByteSize size, const ByteSize alignment) {
+    ByteSize header_size_ = _memory_zone_debug_header_size(zone, alignment);
+    Bool     guarded_     = _memory_zone_debug_guarded(zone, size);
+
+    // pools check the slot themselves and keep no links in it, so it is poisoned once it is released
+    if (!header_size_) {
+        MemoryZoneResult result_ = _memory_zone_deallocate_block(zone, ptr, size, alignment);
+        if (result_ == MEMORY_ZONE_SUCCESS)
+            memset(ptr, DEBUG_POISON_FREED, size);
+
+        return result_;
+    }
+
+    MemoryZoneResult check_ = _memory_zone_debug_check(zone, ptr, size, guarded_);
+    if (check_ != MEMORY_ZONE_SUCCESS)
+        return check_;
+
+    _memory_zone_debug_unlink(zone, (MemoryZoneDebugHeader *)ptr - 1);
+
+    if (guarded_)
+        return _memory_zone_debug_deallocate_guarded(zone, ptr);
+
+    // poisoned before the zone threads its own links through the block
+    BytePtr block_ = (BytePtr)ptr - header_size_;
+    memset(block_, DEBUG_POISON_FREED, header_size_ + size + DEBUG_CANARY_SIZE);
+
+    return _memory_zone_deallocate_block(zone, block_, header_size_ + size + DEBUG_CANARY_SIZE, alignment);
+}
+#endif
+
+// ---------------------------------------------------------------------- //
+
+MemoryZoneResult _memory_zone_allocate(const MemoryZoneHandle handle, const ByteSize size, const ByteSize alignment, const Bool zeroed, VoidPtr *out_ptr, ByteSize *out_alloc_size) {
+    if (!size || !out_ptr) return MEMORY_ZONE_ERROR_INVALID_PARAM;
+
+    MemoryZone *zone_ = _memory_zone_resolve(handle);
+    if (!zone_) return MEMORY_ZONE_ERROR_NOT_EXIST;
+
+#if defined(VYTAL_MEMORY_DEBUG)
+    MemoryZoneResult result_ = _memory_zone_debug_allocate(zone_, size, alignment, zeroed, out_ptr, out_alloc_size);
+    if (result_ != MEMORY_ZONE_SUCCESS) return result_;
+#else
+    // arenas, stacks and pools recycle their memory without tracking it, so their blocks are never fresh
+    ByteSize alloc_size_ = 0;
+    Bool     fresh_      = false;
+
+    MemoryZoneResult result_ = _memory_zone_allocate_block(zone_, size, alignment, out_ptr, &alloc_size_, &fresh_);
+    if (result_ != MEMORY_ZONE_SUCCESS) return result_;
+
+    if (zeroed && !fresh_)
+        memset(*out_ptr, 0, alloc_size_);
+
+    if (out_alloc_size)
+        *out_alloc_size = alloc_size_;
+#endif
+
+    _memory_zone_track_peak(zone_);
+
+#if defined(VYTAL_MEMORY_STATS)
+    _memory_zone_record(zone_, size, alignment, true);
+#endif
+
+#if defined(VYTAL_MEMORY_TRACK_CALLSITES)
+    _memory_zone_record_callsite(handle, size);
+#endif
+
+    return result_;
+}
+
+MemoryZoneResult _memory_zone_deallocate(const MemoryZoneHandle handle, const VoidPtr ptr, const ByteSize size, const ByteSize alignment) {
+    if (!ptr || !size) return MEMORY_ZONE_ERROR_INVALID_PARAM;
+
+    MemoryZone *zone_ = _memory_zone_resolve(handle);
+    if (!zone_) return MEMORY_ZONE_ERROR_NOT_EXIST;
+
+#if defined(VYTAL_MEMORY_DEBUG)
+    MemoryZoneResult result_ = _memory_zone_debug_deallocate(zone_, ptr, size, alignment);
+#else
+    MemoryZoneResult result_ = _memory_zone_deallocate_block(zone_, ptr, size, alignment);
+#endif
+
+#if defined(VYTAL_MEMORY_STATS)
+    if (result_ == MEMORY_ZONE_SUCCESS)
+        _memory_zone_record(zone_, size, alignment, false);
+#endif
+
+    return result_;
+}
+
+MemoryZoneResult memory_zone_extend(const MemoryZoneHandle handle, const VoidPtr ptr, const ByteSize size, const ByteSize new_size, ByteSize *out_alloc_size) {
+    if (!ptr || !size || (new_size < size)) return MEMORY_ZONE_ERROR_INVALID_PARAM;
+
+    MemoryZone *zone_ = _memory_zone_resolve(handle);
+    if (!zone_) return MEMORY_ZONE_ERROR_NOT_EXIST;
+
+#if defined(VYTAL_MEMORY_DEBUG)
+    if (_memory_zone_debug_guarded(zone_, size) || _memory_zone_debug_guarded(zone_, new_size)) return MEMORY_ZONE_ERROR_INSUFFICIENT_MEMORY;
+
+    MemoryZoneResult result_ = _memory_zone_debug_check(zone_, ptr, size, false);
+    if (result_ != MEMORY_ZONE_SUCCESS) return result_;
+
+    ByteSize header_size_ = _memory_zone_debug_header_size(zone_, MEMORY_ALIGNMENT_SIZE);
+    result_               = _memory_zone_extend_block(zone_, (BytePtr)ptr - header_size_, header_size_ + size + DEBUG_CANARY_SIZE, header_size_ + new_size + DEBUG_CANARY_SIZE, NULL);
+    if (result_ != MEMORY_ZONE_SUCCESS) return result_;
+
+    // the old canary turns into payload and a new one goes behind it
+    UInt64 canary_ = DEBUG_CANARY;
+    memset((BytePtr)ptr + size, DEBUG_POISON_FRESH, new_size - size);
+    memcpy((BytePtr)ptr + new_size, &canary_, DEBUG_CANARY_SIZE);
+    ((MemoryZoneDebugHeader *)ptr - 1)->_size = new_size;
+
+    if (out_alloc_size)
+        *out_alloc_size = new_size;
+#else
+    MemoryZoneResult result_ = _memory_zone_extend_block(zone_, ptr, size, new_size, out_alloc_size);
+    if (result_ != MEMORY_ZONE_SUCCESS) return result_;
+#endif
+
+    _memory_zone_track_peak(zone_);
+
+    // counted as the old block going and the new one coming
+#if defined(VYTAL_MEMORY_STATS)
+    _memory_zone_record(zone_, size, MEMORY_ALIGNMENT_SIZE, false);
+    _memory_zone_record(zone_, new_size, MEMORY_ALIGNMENT_SIZE, true);
+#endif
+
+    return MEMORY_ZONE_SUCCESS;
+}
+
+MemoryZoneResult memory_zone_allocate(const MemoryZoneHandle handle, const ByteSize size, VoidPtr *out_ptr, ByteSize *out_alloc_size) {
+    return _memory_zone_allocate(handle, size, MEMORY_ALIGNMENT_SIZE, false, out_ptr, out_alloc_size);
+}
+
+MemoryZoneResult memory_zone_deallocate(const MemoryZoneHandle handle, const VoidPtr ptr, const ByteSize size) {
+    return _memory_zone_deallocate(handle, ptr, size, MEMORY_ALIGNMENT_SIZE);
+}
+
+MemoryZoneResult memory_zone_allocate_zeroed(const MemoryZoneHandle handle, const ByteSize size, VoidPtr *out_ptr, ByteSize *out_alloc_size) {
+    return _memory_zone_allocate(handle, size, MEMORY_ALIGNMENT_SIZE, true, out_ptr, out_alloc_size);
+}
+
+MemoryZoneResult memory_zone_allocate_aligned(const MemoryZoneHandle handle, const ByteSize size, const ByteSize alignment, VoidPtr *out_ptr, ByteSize *out_alloc_size) {
+    if (!alignment || (alignment & (alignment - 1))) return MEMORY_ZONE_ERROR_INVALID_PARAM;
+    return _memory_zone_allocate(handle, size, (alignment > MEMORY_ALIGNMENT_SIZE) ? alignment : MEMORY_ALIGNMENT_SIZE, false, out_ptr, out_alloc_size);
+}
+
+MemoryZoneResult memory_zone_deallocate_aligned(const MemoryZoneHandle handle, const VoidPtr ptr, const ByteSize size, const ByteSize alignment) {
+    if (!alignment || (alignment & (alignment - 1))) return MEMORY_ZONE_ERROR_INVALID_PARAM;
+    return _memory_zone_deallocate(handle, ptr, size, (alignment > MEMORY_ALIGNMENT_SIZE) ? alignment : MEMORY_ALIGNMENT_SIZE);
+}
+
+MemoryZoneResult memory_zone_advance_frame(const MemoryZoneHandle handle) {
+    MemoryZone *zone_ = _memory_zone_resolve(handle);
+    if (!zone_) return MEMORY_ZONE_ERROR_NOT_EXIST;
+
+    if (zone_->_type != MEMORY_ZONE_TYPE_FRAME_ARENA) return MEMORY_ZONE_ERROR_INVALID_PARAM;
+    return memory_zone_frame_arena_advance(zone_);
+}
+
+MemoryZoneResult memory_zone_push_marker(const MemoryZoneHandle handle, MemoryZoneMarker *out_marker) {
+    if (!out_marker) return MEMORY_ZONE_ERROR_INVALID_PARAM;
+
+    MemoryZone *zone_ = _memory_zone_resolve(handle);
+    if (!zone_) return MEMORY_ZONE_ERROR_NOT_EXIST;
+
+    if (zone_->_type != MEMORY_ZONE_TYPE_STACK) return MEMORY_ZONE_ERROR_INVALID_PARAM;
+    return memory_zone_stack_push_marker(zone_, out_marker);
+}
+
+MemoryZoneResult memory_zone_pop_to_marker(const MemoryZoneHandle handle, const MemoryZoneMarker marker) {
+    MemoryZone *zone_ = _memory_zone_resolve(handle);
+    if (!zone_) return MEMORY_ZONE_ERROR_NOT_EXIST;
+
+    if (zone_->_type != MEMORY_ZONE_TYPE_STACK) return MEMORY_ZONE_ERROR_INVALID_PARAM;
+    return memory_zone_stack_pop_to_marker(zone_, marker);
+}
+
+MemoryZoneResult memory_zone_get_pool_handle(const MemoryZoneHandle handle, const VoidPtr ptr, MemoryZonePoolHandle *out_pool_handle) {
+    MemoryZone *zone_ = _memory_zone_resolve(handle);
+    if (!zone_) return MEMORY_ZONE_ERROR_NOT_EXIST;
+
+    if (zone_->_type != MEMORY_ZONE_TYPE_POOL) return MEMORY_ZONE_ERROR_INVALID_PARAM;
+    return memory_zone_pool_get_handle(zone_, ptr, out_pool_handle);
+}
+
+MemoryZoneResult memory_zone_resolve_pool_handle(const MemoryZoneHandle handle, const MemoryZonePoolHandle pool_handle, VoidPtr *out_ptr) {
+    MemoryZone *zone_ = _memory_zone_resolve(handle);
+    if (!zone_) return MEMORY_ZONE_ERROR_NOT_EXIST;
+
+    if (zone_->_type != MEMORY_ZONE_TYPE_POOL) return MEMORY_ZONE_ERROR_INVALID_PARAM;
+    return memory_zone_pool_resolve_handle(zone_, pool_handle, out_ptr);
+}
+
+MemoryZoneResult memory_zone_next_pool_slot(const MemoryZoneHandle handle, ByteSize *cursor, VoidPtr *out_ptr) {
+    MemoryZone *zone_ = _memory_zone_resolve(handle);
+    if (!zone_) return MEMORY_ZONE_ERROR_NOT_EXIST;
+
+    if (zone_->_type != MEMORY_ZONE_TYPE_POOL) return MEMORY_ZONE_ERROR_INVALID_PARAM;
+    return memory_zone_pool_next_live(zone_, cursor, out_ptr);
+}
+
+MemoryZoneResult memory_zone_get_stats(const MemoryZoneHandle handle, MemoryZoneStats *out_stats) {
+    if (!out_stats) return MEMORY_ZONE_ERROR_INVALID_PARAM;
+
+    MemoryZone *zone_ = _memory_zone_resolve(handle);
+    if (!zone_) return MEMORY_ZONE_ERROR_NOT_EXIST;
+
+    out_stats->_capacity            = zone_->_capacity + zone_->_grown_capacity;
+    out_stats->_used_memory         = __atomic_load_n(&zone_->_used_memory, __ATOMIC_RELAXED);
+    out_stats->_requested_memory    = __atomic_load_n(&zone_->_requested_memory, __ATOMIC_RELAXED);
+    out_stats->_peak_used_memory    = zone_->_peak_used_memory;
+    out_stats->_peak_capacity       = zone_->_peak_capacity;
+    out_stats->_num_allocations     = zone_->_num_allocations;
+    out_stats->_num_deallocations   = zone_->_num_deallocations;
+    out_stats->_frame_allocations   = zone_->_frame_allocations;
+    out_stats->_frame_deallocations = zone_->_frame_deallocations;
+    out_stats->_num_size_classes    = zone_->_num_classes;
+
+    // only meaningful where requested sizes are tracked
+    out_stats->_fragmentation = (out_stats->_requested_memory && (out_stats->_used_memory > out_stats->_requested_memory))
+                                    ? 1.0f - ((Flt32)out_stats->_requested_memory / (Flt32)out_stats->_used_memory)
+                                    : 0.0f;
+
+    return MEMORY_ZONE_SUCCESS;
+}
+
+MemoryZoneResult memory_zone_get_size_class_stats(const MemoryZoneHandle handle, const ByteSize index, MemoryZoneSizeClassStats *out_stats) {
+    if (!out_stats) return MEMORY_ZONE_ERROR_INVALID_PARAM;
+
+    MemoryZone *zone_ = _memory_zone_resolve(handle);
+    if (!zone_) return MEMORY_ZONE_ERROR_NOT_EXIST;
+    if (index >= zone_->_num_classes) return MEMORY_ZONE_ERROR_INVALID_PARAM;
+
+    MemoryZoneSizeClass *size_class_ = &zone_->_size_classes[index];
+
+    out_stats->_size              = size_class_->_size;
+    out_stats->_live_blocks       = size_class_->_live_blocks;
+    out_stats->_peak_blocks       = size_class_->_peak_blocks;
+    out_stats->_free_blocks       = size_class_->_num_blocks;
+    out_stats->_requested_memory  = size_class_->_requested_memory;
+    out_stats->_num_allocations   = size_class_->_num_allocations;
+    out_stats->_num_deallocations = size_class_->_num_deallocations;
+
+    return MEMORY_ZONE_SUCCESS;
+}
+
+MemoryZoneResult memory_zone_next_callsite(ByteSize *cursor, MemoryZoneCallsiteStats *out_stats) {
+    if (!cursor || !out_stats) return MEMORY_ZONE_ERROR_INVALID_PARAM;
+
+#if defined(VYTAL_MEMORY_TRACK_CALLSITES)
+    for (; *cursor < MEMORY_ZONE_CALLSITE_SLOTS; ++(*cursor)) {
+        if (!callsites[*cursor]._file) continue;
+
+        _memory_zone_lock(&callsites_lock);
+        *out_stats = callsites[(*cursor)++];
+        _memory_zone_unlock(&callsites_lock);
+
+        return MEMORY_ZONE_SUCCESS;
+    }
+#endif
+
+    return MEMORY_ZONE_ERROR_NOT_EXIST;
+}
+
+// snapshots ------------------------------------------------------------ //
+
+// offsets of the sections that follow a snapshot header
+typedef struct Memory_Zone_Snapshot_Layout {
+    ByteSize _size_classes;
+    ByteSize _thread_caches;
+    ByteSize _pool;
+    ByteSize _chunks;
+    ByteSize _region;
+    ByteSize _chunk_contents;  // one section per chunk, newest first
+} MemoryZoneSnapshotLayout;
+
+// general zones and stacks only ever touched what lies below the bump pointer
+VYTAL_INLINE ByteSize _memory_zone_snapshot_extent(MemoryZone *zone) {
+    if ((zone->_type == MEMORY_ZONE_TYPE_GENERAL) || (zone->_type == MEMORY_ZONE_TYPE_STACK))
+        return zone->_bump_offset;
+
+    return VYTAL_BITFLAG_IF_SET(zone->_flags, MEMORY_ZONE_FLAG_RESERVE) ? zone->_committed : zone->_capacity;
+}
+
+VYTAL_INLINE ByteSize _memory_zone_snapshot_section(ByteSize *cursor, const ByteSize size) {
+    ByteSize section_ = *cursor;
+    *cursor += VYTAL_APPLY_ALIGNMENT(size, MEMORY_ALIGNMENT_SIZE);
+    return section_;
+}
+
+VYTAL_INLINE ByteSize _memory_zone_snapshot_thread_caches_size(MemoryZone *zone) {
+    return zone->_thread_caches ? memory_zone_compute_thread_caches_size(zone->_num_classes) : 0;
+}
+
+VYTAL_INLINE ByteSize _memory_zone_snapshot_pool_size(MemoryZone *zone) {
+    return (zone->_type == MEMORY_ZONE_TYPE_POOL) ? memory_zone_pool_compute_metadata_size(zone->_pool._slot_count) : 0;
+}
+
+// returns the size of everything up to the chunk contents
+ByteSize _memory_zone_snapshot_layout(MemoryZone *zone, const ByteSize extent, const ByteSize num_chunks, MemoryZoneSnapshotLayout *out_layout) {
+    ByteSize cursor_ = 0;
+    _memory_zone_snapshot_section(&cursor_, sizeof(struct Memory_Zone_Snapshot));
+
+    out_layout->_size_classes   = _memory_zone_snapshot_section(&cursor_, sizeof(MemoryZoneSizeClass) * zone->_num_classes);
+    out_layout->_thread_caches  = _memory_zone_snapshot_section(&cursor_, _memory_zone_snapshot_thread_caches_size(zone));
+    out_layout->_pool           = _memory_zone_snapshot_section(&cursor_, _memory_zone_snapshot_pool_size(zone));
+    out_layout->_chunks         = _memory_zone_snapshot_section(&cursor_, sizeof(MemoryZoneSnapshotChunk) * num_chunks);
+    out_layout->_region         = _memory_zone_snapshot_section(&cursor_, extent);
+    out_layout->_chunk_contents = cursor_;
+
+    return cursor_;
+}
+
+VYTAL_INLINE void _memory_zone_release_oversized(MemoryZone *zone) {
+    while (zone->_oversized_chunks) {
+        MemoryZoneChunk *chunk_ = zone->_oversized_chunks;
+
+        zone->_oversized_chunks = chunk_->_next;
+        zone->_grown_capacity -= chunk_->_capacity;
+        platform_memory_release(chunk_, chunk_->_size);
+    }
+}
+
+VYTAL_INLINE ByteSize _memory_zone_count_chunks(MemoryZone *zone) {
+    ByteSize num_chunks_ = 0;
+    for (MemoryZoneChunk *chunk_ = zone->_chunks; chunk_; chunk_ = chunk_->_next) ++num_chunks_;
+
+    return num_chunks_;
+}
+
+// drops the chunks chained after the snapshot was taken, as long as the ones it saw are still there
+MemoryZoneResult _memory_zone_snapshot_rewind_chunks(MemoryZone *zone, MemoryZoneSnapshot snapshot, MemoryZoneSnapshotLayout *layout) {
+    ByteSize num_chunks_ = _memory_zone_count_chunks(zone);
+    if (num_chunks_ < snapshot->_num_chunks) return MEMORY_ZONE_ERROR_INVALID_PARAM;
+
+    MemoryZoneChunk *kept_ = zone->_chunks;
+    for (ByteSize i = snapshot->_num_chunks; i < num_chunks_; ++i) kept_ = kept_->_next;
+
+    MemoryZoneSnapshotChunk *records_ = (MemoryZoneSnapshotChunk *)((BytePtr)snapshot + layout->_chunks);
+    for (MemoryZoneChunk *chunk_ = kept_; chunk_; chunk_ = chunk_->_next, ++records_)
+        if (records_->_chunk != chunk_) return MEMORY_ZONE_ERROR_INVALID_PARAM;
+
+    // the snapshot was taken without guarded blocks, so every live one came after it; their links
+    // may run through the chunks about to go, and the restored list will not know about them
+    memory_zone_release_guarded(zone);
+
+    while (zone->_chunks != kept_) {
+        MemoryZoneChunk *chunk_ = zone->_chunks;
+
+        zone->_chunks = chunk_->_next;
+        zone->_grown_capacity -= chunk_->_capacity;
+        platform_memory_release(chunk_, chunk_->_size);
+    }
+
+    return MEMORY_ZONE_SUCCESS;
+}
+
+MemoryZoneResult memory_zone_snapshot(const MemoryZoneHandle handle, MemoryZoneSnapshot *out_snapshot) {
+    if (!out_snapshot) return MEMORY_ZONE_ERROR_INVALID_PARAM;
+
+    MemoryZone *zone_ = _memory_zone_resolve(handle);
+    if (!zone_) return MEMORY_ZONE_ERROR_NOT_EXIST;
+
+    // oversized blocks are released the moment they are freed, so their chunks could not be brought back,
+    // and guarded debug blocks are mapped outside the zone, where the copy does not reach
+    if (zone_->_oversized_chunks || zone_->_guarded_memory) return MEMORY_ZONE_ERROR_INVALID_PARAM;
+
+    MemoryZoneSnapshotLayout layout_;
+    ByteSize                 extent_     = _memory_zone_snapshot_extent(zone_);
+    ByteSize                 num_chunks_ = _memory_zone_count_chunks(zone_);
+    ByteSize                 size_       = _memory_zone_snapshot_layout(zone_, extent_, num_chunks_, &layout_);
+
+    for (MemoryZoneChunk *chunk_ = zone_->_chunks; chunk_; chunk_ = chunk_->_next)
+        _memory_zone_snapshot_section(&size_, chunk_->_bump_offset);
+
+    size_         = VYTAL_APPLY_ALIGNMENT(size_, MEMORY_ZONE_COMMIT_SIZE);
+    VoidPtr addr_ = NULL;
+
+    if (platform_memory_reserve(size_, false, &addr_) != PLATFORM_MEMORY_SUCCESS)
+        return MEMORY_ZONE_ERROR_MEMORY_ALLOCATION;
+
+    if (platform_memory_commit(addr_, size_) != PLATFORM_MEMORY_SUCCESS) {
+        platform_memory_release(addr_, size_);
+        return MEMORY_ZONE_ERROR_MEMORY_ALLOCATION;
+    }
+
+    MemoryZoneSnapshot snapshot_ = (MemoryZoneSnapshot)addr_;
+    snapshot_->_zone             = handle;
+    snapshot_->_size             = size_;
+    snapshot_->_used_memory      = zone_->_used_memory;
+    snapshot_->_bump_offset      = zone_->_bump_offset;
+    snapshot_->_tail_size        = zone_->_tail_size;
+    snapshot_->_dirty_offset     = zone_->_dirty_offset;
+    snapshot_->_frame_index      = zone_->_frame_index;
+    snapshot_->_requested_memory = zone_->_requested_memory;
+    snapshot_->_pool_num_free    = zone_->_pool._num_free;
+    snapshot_->_extent           = extent_;
+    snapshot_->_num_chunks       = num_chunks_;
+    snapshot_->_debug_blocks     = zone_->_debug_blocks;
+
+    // free lists and magazines point into the zone, so they stay valid as long as the contents come back with them
+    BytePtr base_ = (BytePtr)snapshot_;
+    if (zone_->_num_classes) memcpy(base_ + layout_._size_classes, zone_->_size_classes, sizeof(MemoryZoneSizeClass) * zone_->_num_classes);
+    if (zone_->_thread_caches) memcpy(base_ + layout_._thread_caches, zone_->_thread_caches, _memory_zone_snapshot_thread_caches_size(zone_));
+    if (zone_->_type == MEMORY_ZONE_TYPE_POOL) memcpy(base_ + layout_._pool, zone_->_pool._free_slots, _memory_zone_snapshot_pool_size(zone_));
+    memcpy(base_ + layout_._region, zone_->_start_addr, extent_);
+
+    MemoryZoneSnapshotChunk *records_ = (MemoryZoneSnapshotChunk *)(base_ + layout_._chunks);
+    ByteSize                 cursor_  = layout_._chunk_contents;
+
+    for (MemoryZoneChunk *chunk_ = zone_->_chunks; chunk_; chunk_ = chunk_->_next, ++records_) {
+        records_->_chunk       = chunk_;
+        records_->_bump_offset = chunk_->_bump_offset;
+        memcpy(base_ + _memory_zone_snapshot_section(&cursor_, chunk_->_bump_offset), (BytePtr)chunk_ + CHUNK_HEADER_SIZE, chunk_->_bump_offset);
+    }
+
+    *out_snapshot = snapshot_;
+    return MEMORY_ZONE_SUCCESS;
+}
+
+MemoryZoneResult memory_zone_restore(const MemoryZoneHandle handle, const MemoryZoneSnapshot snapshot) {
+    if (!snapshot || (snapshot->_zone != handle)) return MEMORY_ZONE_ERROR_INVALID_PARAM;
+
+    MemoryZone *zone_ = _memory_zone_resolve(handle);
+    if (!zone_) return MEMORY_ZONE_ERROR_NOT_EXIST;
+
+    MemoryZoneSnapshotLayout layout_;
+    _memory_zone_snapshot_layout(zone_, snapshot->_extent, snapshot->_num_chunks, &layout_);
+
+    MemoryZoneResult result_ = _memory_zone_snapshot_rewind_chunks(zone_, snapshot, &layout_);
+    if (result_ != MEMORY_ZONE_SUCCESS)
+        return result_;
+
+    // the snapshot was taken without any, so every oversized block came after it
+    _memory_zone_release_oversized(zone_);
+
+    if ((result_ = memory_zone_ensure_committed(zone_, snapshot->_extent)) != MEMORY_ZONE_SUCCESS)
+        return result_;
+
+    // whatever was handed out on either side of the snapshot is dirty now
+    ByteSize dirty_offset_ = zone_->_dirty_offset;
+    if (zone_->_bump_offset > dirty_offset_) dirty_offset_ = zone_->_bump_offset;
+    if (snapshot->_bump_offset > dirty_offset_) dirty_offset_ = snapshot->_bump_offset;
+    if (snapshot->_dirty_offset > dirty_offset_) dirty_offset_ = snapshot->_dirty_offset;
+
+    // cumulative counters keep running, only the live state goes back
+    BytePtr              base_  = (BytePtr)snapshot;
+    MemoryZoneSizeClass *saved_ = (MemoryZoneSizeClass *)(base_ + layout_._size_classes);
+
+    for (ByteSize i = 0; i < zone_->_num_classes; ++i) {
+        zone_->_size_classes[i]._free_list        = saved_[i]._free_list;
+        zone_->_size_classes[i]._num_blocks       = saved_[i]._num_blocks;
+        zone_->_size_classes[i]._live_blocks      = saved_[i]._live_blocks;
+        zone_->_size_classes[i]._requested_memory = saved_[i]._requested_memory;
+    }
+
+    if (zone_->_thread_caches) memcpy(zone_->_thread_caches, base_ + layout_._thread_caches, _memory_zone_snapshot_thread_caches_size(zone_));
+    if (zone_->_type == MEMORY_ZONE_TYPE_POOL) memcpy(zone_->_pool._free_slots, base_ + layout_._pool, _memory_zone_snapshot_pool_size(zone_));
+    memcpy(zone_->_start_addr, base_ + layout_._region, snapshot->_extent);
+
+    MemoryZoneSnapshotChunk *records_ = (MemoryZoneSnapshotChunk *)(base_ + layout_._chunks);
+    ByteSize                 cursor_  = layout_._chunk_contents;
+
+    for (MemoryZoneChunk *chunk_ = zone_->_chunks; chunk_; chunk_ = chunk_->_next, ++records_) {
+        chunk_->_bump_offset = records_->_bump_offset;
+        memcpy((BytePtr)chunk_ + CHUNK_HEADER_SIZE, base_ + _memory_zone_snapshot_section(&cursor_, chunk_->_bump_offset), chunk_->_bump_offset);
+    }
+
+    zone_->_used_memory      = snapshot->_used_memory;
+    zone_->_bump_offset      = snapshot->_bump_offset;
+    zone_->_tail_size        = snapshot->_tail_size;
+    zone_->_dirty_offset     = dirty_offset_;
+    zone_->_frame_index      = snapshot->_frame_index;
+    zone_->_requested_memory = snapshot->_requested_memory;
+    zone_->_pool._num_free   = snapshot->_pool_num_free;
+    zone_->_debug_blocks     = snapshot->_debug_blocks;
+
+    return MEMORY_ZONE_SUCCESS;
+}
+
+MemoryZoneResult memory_zone_release_snapshot(MemoryZoneSnapshot snapshot) {
+    if (!snapshot) return MEMORY_ZONE_ERROR_INVALID_PARAM;
+
+    if (platform_memory_release(snapshot, snapshot->_size) != PLATFORM_MEMORY_SUCCESS)
+        return MEMORY_ZONE_ERROR_MEMORY_ALLOCATION;
+
+    return MEMORY_ZONE_SUCCESS;
+}
+
+// ---------------------------------------------------------------------- //
+
+void memory_zone_roll_frame_stats(MemoryZone *zone) {
+    ByteSize allocations_   = __atomic_load_n(&zone->_num_allocations, __ATOMIC_RELAXED);
+    ByteSize deallocations_ = __atomic_load_n(&zone->_num_deallocations, __ATOMIC_RELAXED);
+
+    zone->_frame_allocations         = allocations_ - zone->_frame_start_allocations;
+    zone->_frame_deallocations       = deallocations_ - zone->_frame_start_deallocations;
+    zone->_frame_start_allocations   = allocations_;
+    zone->_frame_start_deallocations = deallocations_;
+}
+
+MemoryZoneResult memory_zone_ensure_committed(MemoryZone *zone, const ByteSize end_offset) {
+    if (!VYTAL_BITFLAG_IF_SET(zone->_flags, MEMORY_ZONE_FLAG_RESERVE)) return MEMORY_ZONE_SUCCESS;
+    if (end_offset <= __atomic_load_n(&zone->_committed, __ATOMIC_ACQUIRE)) return MEMORY_ZONE_SUCCESS;
+
+    MemoryZoneResult result_ = MEMORY_ZONE_SUCCESS;
+    _memory_zone_lock(&zone->_commit_lock);
+
+    // another thread may have committed past end_offset in the meantime
+    if (end_offset > zone->_committed) {
+        ByteSize committed_ = VYTAL_APPLY_ALIGNMENT(end_offset, MEMORY_ZONE_COMMIT_GRANULARITY(zone->_flags));
+        if (committed_ > zone->_reserved_size) committed_ = zone->_reserved_size;
+
+        if (platform_memory_commit((BytePtr)zone->_start_addr + zone->_committed, committed_ - zone->_committed) == PLATFORM_MEMORY_SUCCESS)
+            __atomic_store_n(&zone->_committed, committed_, __ATOMIC_RELEASE);
+        else
+            result_ = MEMORY_ZONE_ERROR_MEMORY_ALLOCATION;
+    }
+
+    _memory_zone_unlock(&zone->_commit_lock);
+    return result_;
+}
+
+ByteSize memory_zone_report_leaks(MemoryZone *zone) {
+    ByteSize num_blocks_ = 0;
+
+#if defined(VYTAL_MEMORY_DEBUG)
+    ByteSize leaked_memory_ = 0;
+
+    for (MemoryZoneDebugHeader *header_ = zone->_debug_blocks; header_; header_ = header_->_next) {
+        ++num_blocks_;
+        leaked_memory_ += header_->_size;
+    }
+
+    // pools carry no headers, their live slots are the leaks
+    if (zone->_type == MEMORY_ZONE_TYPE_POOL) {
+        ByteSize cursor_ = 0;
+        VoidPtr  slot_   = NULL;
+
+        while (memory_zone_pool_next_live(zone, &cursor_, &slot_) == MEMORY_ZONE_SUCCESS) {
+            ++num_blocks_;
+            leaked_memory_ += zone->_pool._slot_size;
+        }
+    }
+
+    if (!num_blocks_) return 0;
+
+    fprintf(stderr, "memory zone '%s': %zu blocks (%zu bytes) never released\n", zone->_name, num_blocks_, leaked_memory_);
+
+    for (MemoryZoneDebugHeader *header_ = zone->_debug_blocks; header_; header_ = header_->_next) {
+        if (header_->_file)
+            fprintf(stderr, "    %p, %zu bytes, allocated at %s:%d\n", (VoidPtr)(header_ + 1), header_->_size, header_->_file, header_->_line);
+        else
+            fprintf(stderr, "    %p, %zu bytes\n", (VoidPtr)(header_ + 1), header_->_size);
+    }
+#endif
+
+    return num_blocks_;
+}
+
+void memory_zone_release_chunks(MemoryZone *zone) {
+    MemoryZoneChunk *chunk_ = zone->_chunks;
+
+    while (chunk_) {
+        MemoryZoneChunk *next_ = chunk_->_next;
+        platform_memory_release(chunk_, chunk_->_size);
+        chunk_ = next_;
+    }
+
+    _memory_zone_release_oversized(zone);
+
+    zone->_chunks         = NULL;
+    zone->_grown_capacity = 0;
+}
+
+// live guarded blocks go first (their headers are what chains them), then the quarantined ranges
+void memory_zone_release_guarded(MemoryZone *zone) {
+#if defined(VYTAL_MEMORY_DEBUG)
+    MemoryZoneDebugHeader *header_ = zone->_debug_blocks;
+
+    while (header_) {
+        MemoryZoneDebugHeader *next_ = header_->_next;
+
+        if (_memory_zone_debug_guarded(zone, header_->_size)) {
+            _memory_zone_debug_unlink(zone, header_);
+            _memory_zone_add_used(zone, (ByteSize)0 - (header_->_mapping_size - MEMORY_ZONE_COMMIT_SIZE));
+            platform_memory_release(header_->_mapping, header_->_mapping_size);
+        }
+
+        header_ = next_;
+    }
+
+    for (ByteSize i = 0; i < MEMORY_ZONE_GUARD_QUARANTINE; ++i) {
+        MemoryZoneGuardRange *range_ = &zone->_guard_quarantine[i];
+        if (range_->_addr) platform_memory_release(range_->_addr, range_->_size);
+
+        range_->_addr = NULL;
+        range_->_size = 0;
+    }
+
+    zone->_guarded_memory        = 0;
+    zone->_guard_quarantine_next = 0;
+#else
+    (void)zone;
+#endif
+}
+
+void memory_zone_compute_size_classes(ByteSize *out_num_classes, MemoryZoneSizeClass **out_size_classes, const ByteSize capacity) {
+    _memory_zone_compute_size_classes(out_num_classes, out_size_classes, capacity);
+}
+
+ByteSize memory_zone_compute_thread_caches_size(const ByteSize num_classes) {
+    return sizeof(MemoryZoneMagazine) * num_classes * MEMORY_ZONE_THREAD_CACHES;
 }
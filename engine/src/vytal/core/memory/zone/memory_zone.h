@@ -3,10 +3,55 @@
 #include "vytal/defines/core/memory.h"
 #include "vytal/defines/shared.h"
 
-VYTAL_API MemoryZoneResult memory_zone_get(ConstStr zone_name, MemoryZone **out_zone);
-VYTAL_API MemoryZoneResult memory_zone_clear(ConstStr zone_name);
+VYTAL_API MemoryZoneResult memory_zone_get_handle(ConstStr zone_name, MemoryZoneHandle *out_handle);
+VYTAL_API MemoryZoneResult memory_zone_get(const MemoryZoneHandle handle, MemoryZone **out_zone);
+VYTAL_API MemoryZoneResult memory_zone_clear(const MemoryZoneHandle handle);
 
-VYTAL_API MemoryZoneResult memory_zone_allocate(ConstStr zone_name, const ByteSize size, VoidPtr *out_ptr, ByteSize *out_alloc_size);
-VYTAL_API MemoryZoneResult memory_zone_deallocate(ConstStr zone_name, const VoidPtr ptr, const ByteSize size);
+VYTAL_API MemoryZoneResult memory_zone_allocate(const MemoryZoneHandle handle, const ByteSize size, VoidPtr *out_ptr, ByteSize *out_alloc_size);
+VYTAL_API MemoryZoneResult memory_zone_deallocate(const MemoryZoneHandle handle, const VoidPtr ptr, const ByteSize size);
+VYTAL_API MemoryZoneResult memory_zone_allocate_zeroed(const MemoryZoneHandle handle, const ByteSize size, VoidPtr *out_ptr, ByteSize *out_alloc_size);
+VYTAL_API MemoryZoneResult memory_zone_allocate_aligned(const MemoryZoneHandle handle, const ByteSize size, const ByteSize alignment, VoidPtr *out_ptr, ByteSize *out_alloc_size);
+VYTAL_API MemoryZoneResult memory_zone_deallocate_aligned(const MemoryZoneHandle handle, const VoidPtr ptr, const ByteSize size, const ByteSize alignment);
+
+// grows a block without moving it, which only works for the last block bumped off a plain general zone;
+// it is freed with new_size from then on. MEMORY_ZONE_ERROR_INSUFFICIENT_MEMORY means allocate and copy instead
+VYTAL_API MemoryZoneResult memory_zone_extend(const MemoryZoneHandle handle, const VoidPtr ptr, const ByteSize size, const ByteSize new_size, ByteSize *out_alloc_size);
+
+VYTAL_API MemoryZoneResult memory_zone_advance_frame(const MemoryZoneHandle handle);
+VYTAL_API MemoryZoneResult memory_zone_push_marker(const MemoryZoneHandle handle, MemoryZoneMarker *out_marker);
+VYTAL_API MemoryZoneResult memory_zone_pop_to_marker(const MemoryZoneHandle handle, const MemoryZoneMarker marker);
+
+VYTAL_API MemoryZoneResult memory_zone_get_pool_handle(const MemoryZoneHandle handle, const VoidPtr ptr, MemoryZonePoolHandle *out_pool_handle);
+VYTAL_API MemoryZoneResult memory_zone_resolve_pool_handle(const MemoryZoneHandle handle, const MemoryZonePoolHandle pool_handle, VoidPtr *out_ptr);
+VYTAL_API MemoryZoneResult memory_zone_next_pool_slot(const MemoryZoneHandle handle, ByteSize *cursor, VoidPtr *out_ptr);
+
+// not thread-safe: nothing may allocate from the zone while it is captured or restored; zones holding
+// oversized blocks (growable zones past their last size class) or guarded debug blocks cannot be captured
+VYTAL_API MemoryZoneResult memory_zone_snapshot(const MemoryZoneHandle handle, MemoryZoneSnapshot *out_snapshot);
+VYTAL_API MemoryZoneResult memory_zone_restore(const MemoryZoneHandle handle, const MemoryZoneSnapshot snapshot);
+VYTAL_API MemoryZoneResult memory_zone_release_snapshot(MemoryZoneSnapshot snapshot);
+
+VYTAL_API MemoryZoneResult memory_zone_get_stats(const MemoryZoneHandle handle, MemoryZoneStats *out_stats);
+VYTAL_API MemoryZoneResult memory_zone_get_size_class_stats(const MemoryZoneHandle handle, const ByteSize index, MemoryZoneSizeClassStats *out_stats);
+VYTAL_API MemoryZoneResult memory_zone_next_callsite(ByteSize *cursor, MemoryZoneCallsiteStats *out_stats);
+
+VYTAL_API MemoryZoneResult memory_zone_ensure_committed(MemoryZone *zone, const ByteSize end_offset);
+VYTAL_API void             memory_zone_release_chunks(MemoryZone *zone);
+VYTAL_API void             memory_zone_release_guarded(MemoryZone *zone);
+VYTAL_API ByteSize         memory_zone_report_leaks(MemoryZone *zone);
+VYTAL_API void             memory_zone_roll_frame_stats(MemoryZone *zone);
 
 VYTAL_API void memory_zone_compute_size_classes(ByteSize *out_num_classes, MemoryZoneSizeClass **out_size_classes, const ByteSize capacity);
+VYTAL_API ByteSize memory_zone_compute_thread_caches_size(const ByteSize num_classes);
+
+// tracking builds tag every allocation with the line that made it
+#if defined(VYTAL_MEMORY_TRACK_CALLSITES)
+VYTAL_API void memory_zone_tag_callsite(ConstStr file, const Int32 line);
+
+#    define memory_zone_allocate(handle, size, out_ptr, out_alloc_size) \
+        (memory_zone_tag_callsite(__FILE__, __LINE__), memory_zone_allocate(handle, size, out_ptr, out_alloc_size))
+#    define memory_zone_allocate_zeroed(handle, size, out_ptr, out_alloc_size) \
+        (memory_zone_tag_callsite(__FILE__, __LINE__), memory_zone_allocate_zeroed(handle, size, out_ptr, out_alloc_size))
+#    define memory_zone_allocate_aligned(handle, size, alignment, out_ptr, out_alloc_size) \
+        (memory_zone_tag_callsite(__FILE__, __LINE__), memory_zone_allocate_aligned(handle, size, alignment, out_ptr, out_alloc_size))
+#endif
@@ -49,37 +49,105 @@ static KeyBindingEntry key_binding_table[] = {
 };
 static InputModuleState *state = NULL;
 
-ConstStr event_code_names[] = {
-    // application events
-    "VYTAL_EVENTCODE_WINDOW_CLOSE",
-
-    // key events
-    "VYTAL_EVENTCODE_KEY_PRESSED",
-    "VYTAL_EVENTCODE_KEY_RELEASED",
-
-    // mouse events
-    "VYTAL_EVENTCODE_MOUSE_PRESSED",
-    "VYTAL_EVENTCODE_MOUSE_RELEASED",
-    "VYTAL_EVENTCODE_MOUSE_MOVED",
-    "VYTAL_EVENTCODE_MOUSE_SCROLLED",
-
-    // window events
-    "VYTAL_EVENTCODE_RESIZED",
-
-    // test events
-    "VYTAL_EVENTCODE_TESTUNIT_00",
-    "VYTAL_EVENTCODE_TESTUNIT_01",
-    "VYTAL_EVENTCODE_TESTUNIT_02",
-    "VYTAL_EVENTCODE_TESTUNIT_03",
-    "VYTAL_EVENTCODE_TESTUNIT_04",
-};
+// every event code once; both tables below are generated from it and indexed by the code itself
+#define INPUT_EVENT_CODES(X)            \
+    /* application events */            \
+    X(VYTAL_EVENTCODE_WINDOW_CLOSE)     \
+    /* key events */                    \
+    X(VYTAL_EVENTCODE_KEY_PRESSED)      \
+    X(VYTAL_EVENTCODE_KEY_RELEASED)     \
+    /* mouse events */                  \
+    X(VYTAL_EVENTCODE_MOUSE_PRESSED)    \
+    X(VYTAL_EVENTCODE_MOUSE_RELEASED)   \
+    X(VYTAL_EVENTCODE_MOUSE_MOVED)      \
+    X(VYTAL_EVENTCODE_MOUSE_SCROLLED)   \
+    /* window events */                 \
+    X(VYTAL_EVENTCODE_RESIZED)          \
+    /* test events */                   \
+    X(VYTAL_EVENTCODE_TESTUNIT_00)      \
+    X(VYTAL_EVENTCODE_TESTUNIT_01)      \
+    X(VYTAL_EVENTCODE_TESTUNIT_02)      \
+    X(VYTAL_EVENTCODE_TESTUNIT_03)      \
+    X(VYTAL_EVENTCODE_TESTUNIT_04)
+
+#define INPUT_EVENT_CODE_NAME(code) [code] = #code,
+#define INPUT_EVENT_CODE_HASH(code) [code] = HASH_LITERAL(#code),
+#define INPUT_EVENT_CODE_COUNT(code) +1
+
+// the codes start at 0x01, so a code added to the enum but not to the list above fails here
+_Static_assert((0 INPUT_EVENT_CODES(INPUT_EVENT_CODE_COUNT)) == VYTAL_EVENTCODES_TOTAL - 1, "every input event code needs an INPUT_EVENT_CODES entry");
+
+static ConstStr event_code_names[VYTAL_EVENTCODES_TOTAL] = {INPUT_EVENT_CODES(INPUT_EVENT_CODE_NAME)};
+
+// hashed once at compile time, so dispatch never rehashes the names
+static const HashedInt event_code_hashes[VYTAL_EVENTCODES_TOTAL] = {INPUT_EVENT_CODES(INPUT_EVENT_CODE_HASH)};
+
+// the section's lines, read into a line buffer the caller owns
+static InputModuleResult _input_module_parse_section(File *file, Str line) {
+    Char section_[FILENAME_BUFFER_MAX_SIZE] = {0};
+
+    ByteSize seek_length_ = 0;
+    while (platform_filesystem_read_line(file, &seek_length_, &line) == FILE_SUCCESS) {
+        Str trimmed_ = line;
+
+        if (parse_trim_whitespace(&trimmed_) != PARSE_SUCCESS)
+            return INPUT_MODULE_ERROR_PARSE_FAILED;
+
+        if (*trimmed_ == '#' || *trimmed_ == '\0') continue;
+
+        // check for new section header (e.g. [section_name])
+        if (*trimmed_ == '[') {
+            sscanf(trimmed_, "[%[^]]]", section_);
+
+            if (strncmp(section_, "input", 5)) {
+                platform_filesystem_seek_from_current(file, -seek_length_);
+                break;
+            } else
+                continue;
+        }
+
+        Char key_[LINE_BUFFER_MAX_SIZE]   = {0};
+        Char value_[LINE_BUFFER_MAX_SIZE] = {0};
+        if (!parse_key_value(trimmed_, key_, value_)) continue;
+
+        Str end_;
+
+        // handle general settings
+        if (!strcmp(section_, "input.general")) {
+            // mouse sensitivity
+            if (!strcmp(key_, "mouse_sensitivity")) {
+                Flt32 parsed_value_ = strtof(value_, &end_);
+                if (*end_ != '\0') return INPUT_MODULE_ERROR_PARSE_FAILED;
+                state->_mouse_sensitivity = parsed_value_;
+            }
+
+            // invert y-axis
+            else if (!strcmp(key_, "invert_y_axis")) {
+                state->_invert_y_axis = (!strcmp(value_, "true"));
+            }
+        }
+
+        // handle bindings
+        else if (!strcmp(section_, "input.bindings")) {
+            ByteSize table_length_ = VYTAL_ARRAY_SIZE(key_binding_table);
+            for (Int32 i = 0; i < table_length_; ++i) {
+                if (!strcmp(key_binding_table[i]._name, key_)) {
+                    if (container_map_insert(&state->_key_bindings_map, key_, &key_binding_table[i]._code) != CONTAINER_SUCCESS)
+                        return INPUT_MODULE_ERROR_DATA_INSERT_FAILED;
+                }
+            }
+        }
+    }
+
+    return INPUT_MODULE_SUCCESS;
+}
 
 InputModuleResult input_module_startup(File *file) {
     if (!file) return INPUT_MODULE_ERROR_INVALID_PARAM;
 
     // allocate module state and configure its members
     ByteSize state_allocated_size_ = 0;
-    if (memory_zone_allocate("modules", sizeof(InputModuleState), (VoidPtr *)&state, &state_allocated_size_) != MEMORY_ZONE_SUCCESS)
+    if (memory_zone_allocate(MEMORY_ZONE_MODULES, sizeof(InputModuleState), (VoidPtr *)&state, &state_allocated_size_) != MEMORY_ZONE_SUCCESS)
         return INPUT_MODULE_ERROR_ALLOCATION_FAILED;
     memset(state, 0, sizeof(InputModuleState));
     state->_memory_size = state_allocated_size_;
@@ -90,7 +158,7 @@ InputModuleResult input_module_startup(File *file) {
 
         // current keyboard state
         {
-            if (memory_zone_allocate("input", sizeof(InputKeyboardState), (VoidPtr *)&state->_curr_keyboard_state, &alloc_size_) != MEMORY_ZONE_SUCCESS)
+            if (memory_zone_allocate(MEMORY_ZONE_INPUT, sizeof(InputKeyboardState), (VoidPtr *)&state->_curr_keyboard_state, &alloc_size_) != MEMORY_ZONE_SUCCESS)
                 return INPUT_MODULE_ERROR_ALLOCATION_FAILED;
             memset(state->_curr_keyboard_state, 0, sizeof(InputKeyboardState));
             state->_curr_keyboard_state->_memory_size = alloc_size_;
@@ -98,7 +166,7 @@ InputModuleResult input_module_startup(File *file) {
 
         // previous keyboard state
         {
-            if (memory_zone_allocate("input", sizeof(InputKeyboardState), (VoidPtr *)&state->_prev_keyboard_state, &alloc_size_) != MEMORY_ZONE_SUCCESS)
+            if (memory_zone_allocate(MEMORY_ZONE_INPUT, sizeof(InputKeyboardState), (VoidPtr *)&state->_prev_keyboard_state, &alloc_size_) != MEMORY_ZONE_SUCCESS)
                 return INPUT_MODULE_ERROR_ALLOCATION_FAILED;
             memset(state->_prev_keyboard_state, 0, sizeof(InputKeyboardState));
             state->_prev_keyboard_state->_memory_size = alloc_size_;
@@ -106,7 +174,7 @@ InputModuleResult input_module_startup(File *file) {
 
         // current mouse state
         {
-            if (memory_zone_allocate("input", sizeof(InputMouseState), (VoidPtr *)&state->_curr_mouse_state, &alloc_size_) != MEMORY_ZONE_SUCCESS)
+            if (memory_zone_allocate(MEMORY_ZONE_INPUT, sizeof(InputMouseState), (VoidPtr *)&state->_curr_mouse_state, &alloc_size_) != MEMORY_ZONE_SUCCESS)
                 return INPUT_MODULE_ERROR_ALLOCATION_FAILED;
             memset(state->_curr_mouse_state, 0, sizeof(InputMouseState));
             state->_curr_mouse_state->_memory_size = alloc_size_;
@@ -114,7 +182,7 @@ InputModuleResult input_module_startup(File *file) {
 
         // previous mouse state
         {
-            if (memory_zone_allocate("input", sizeof(InputMouseState), (VoidPtr *)&state->_prev_mouse_state, &alloc_size_) != MEMORY_ZONE_SUCCESS)
+            if (memory_zone_allocate(MEMORY_ZONE_INPUT, sizeof(InputMouseState), (VoidPtr *)&state->_prev_mouse_state, &alloc_size_) != MEMORY_ZONE_SUCCESS)
                 return INPUT_MODULE_ERROR_ALLOCATION_FAILED;
             memset(state->_prev_mouse_state, 0, sizeof(InputMouseState));
             state->_prev_mouse_state->_memory_size = alloc_size_;
@@ -123,68 +191,28 @@ InputModuleResult input_module_startup(File *file) {
 
     // key bindings
     if (container_map_construct(sizeof(InputKeyCode), &state->_key_bindings_map) != CONTAINER_SUCCESS) {
-        if (memory_zone_deallocate("modules", state, state->_memory_size) != MEMORY_ZONE_SUCCESS)
+        if (memory_zone_deallocate(MEMORY_ZONE_MODULES, state, state->_memory_size) != MEMORY_ZONE_SUCCESS)
             return INPUT_MODULE_ERROR_DEALLOCATION_FAILED;
 
         return INPUT_MODULE_ERROR_ALLOCATION_FAILED;
     }
 
-    Char section_[FILENAME_BUFFER_MAX_SIZE] = {0};
-
-    ByteSize seek_length_ = 0;
-    Str      line_        = calloc(1, LINE_BUFFER_MAX_SIZE);
-    while (platform_filesystem_read_line(file, &seek_length_, &line_) == FILE_SUCCESS) {
-        Str trimmed_ = line_;
-
-        if (parse_trim_whitespace(&trimmed_) != PARSE_SUCCESS)
-            return INPUT_MODULE_ERROR_PARSE_FAILED;
-
-        if (*trimmed_ == '#' || *trimmed_ == '\0') continue;
-
-        // check for new section header (e.g. [section_name])
-        if (*trimmed_ == '[') {
-            sscanf(trimmed_, "[%[^]]]", section_);
-
-            if (strncmp(section_, "input", 5)) {
-                platform_filesystem_seek_from_current(file, -seek_length_);
-                break;
-            } else
-                continue;
-        }
-
-        Char key_[LINE_BUFFER_MAX_SIZE]   = {0};
-        Char value_[LINE_BUFFER_MAX_SIZE] = {0};
-        if (!parse_key_value(trimmed_, key_, value_)) continue;
+    // the line buffer only lives on the scratch stack while the section is parsed
+    MemoryZoneMarker scratch_marker_ = 0;
+    if (memory_zone_push_marker(MEMORY_ZONE_SCRATCH, &scratch_marker_) != MEMORY_ZONE_SUCCESS)
+        return INPUT_MODULE_ERROR_ALLOCATION_FAILED;
 
-        Str end_;
+    Str               line_  = NULL;
+    InputModuleResult parse_ = INPUT_MODULE_ERROR_ALLOCATION_FAILED;
 
-        // handle general settings
-        if (!strcmp(section_, "input.general")) {
-            // mouse sensitivity
-            if (!strcmp(key_, "mouse_sensitivity")) {
-                Flt32 parsed_value_ = strtof(value_, &end_);
-                if (*end_ != '\0') return INPUT_MODULE_ERROR_PARSE_FAILED;
-                state->_mouse_sensitivity = parsed_value_;
-            }
+    if (memory_zone_allocate(MEMORY_ZONE_SCRATCH, LINE_BUFFER_MAX_SIZE, (VoidPtr *)&line_, NULL) == MEMORY_ZONE_SUCCESS)
+        parse_ = _input_module_parse_section(file, line_);
 
-            // invert y-axis
-            else if (!strcmp(key_, "invert_y_axis")) {
-                state->_invert_y_axis = (!strcmp(value_, "true"));
-            }
-        }
+    // every way out of the parse comes through here, so the scratch stack is always popped back
+    if ((memory_zone_pop_to_marker(MEMORY_ZONE_SCRATCH, scratch_marker_) != MEMORY_ZONE_SUCCESS) && (parse_ == INPUT_MODULE_SUCCESS))
+        parse_ = INPUT_MODULE_ERROR_DEALLOCATION_FAILED;
 
-        // handle bindings
-        else if (!strcmp(section_, "input.bindings")) {
-            ByteSize table_length_ = VYTAL_ARRAY_SIZE(key_binding_table);
-            for (Int32 i = 0; i < table_length_; ++i) {
-                if (!strcmp(key_binding_table[i]._name, key_)) {
-                    if (container_map_insert(&state->_key_bindings_map, key_, &key_binding_table[i]._code) != CONTAINER_SUCCESS)
-                        return INPUT_MODULE_ERROR_DATA_INSERT_FAILED;
-                }
-            }
-        }
-    }
-    free(line_);
+    if (parse_ != INPUT_MODULE_SUCCESS) return parse_;
 
     state->_initialized = true;
     return INPUT_MODULE_SUCCESS;
@@ -205,28 +233,28 @@ InputModuleResult input_module_shutdown(void) {
     // deallocate state members
     {
         // current keyboard state
-        if (memory_zone_deallocate("input", state->_curr_keyboard_state, state->_curr_keyboard_state->_memory_size) != MEMORY_ZONE_SUCCESS)
+        if (memory_zone_deallocate(MEMORY_ZONE_INPUT, state->_curr_keyboard_state, state->_curr_keyboard_state->_memory_size) != MEMORY_ZONE_SUCCESS)
             return INPUT_MODULE_ERROR_DEALLOCATION_FAILED;
         state->_curr_keyboard_state = NULL;
 
         // previous keyboard state
-        if (memory_zone_deallocate("input", state->_prev_keyboard_state, state->_prev_keyboard_state->_memory_size) != MEMORY_ZONE_SUCCESS)
+        if (memory_zone_deallocate(MEMORY_ZONE_INPUT, state->_prev_keyboard_state, state->_prev_keyboard_state->_memory_size) != MEMORY_ZONE_SUCCESS)
             return INPUT_MODULE_ERROR_DEALLOCATION_FAILED;
         state->_prev_keyboard_state = NULL;
 
         // current mouse state
-        if (memory_zone_deallocate("input", state->_curr_mouse_state, state->_curr_mouse_state->_memory_size) != MEMORY_ZONE_SUCCESS)
+        if (memory_zone_deallocate(MEMORY_ZONE_INPUT, state->_curr_mouse_state, state->_curr_mouse_state->_memory_size) != MEMORY_ZONE_SUCCESS)
             return INPUT_MODULE_ERROR_DEALLOCATION_FAILED;
         state->_curr_mouse_state = NULL;
 
         // previous mouse state
-        if (memory_zone_deallocate("input", state->_prev_mouse_state, state->_prev_mouse_state->_memory_size) != MEMORY_ZONE_SUCCESS)
+        if (memory_zone_deallocate(MEMORY_ZONE_INPUT, state->_prev_mouse_state, state->_prev_mouse_state->_memory_size) != MEMORY_ZONE_SUCCESS)
             return INPUT_MODULE_ERROR_DEALLOCATION_FAILED;
         state->_prev_mouse_state = NULL;
     }
 
     // deallocate state self
-    if (memory_zone_deallocate("modules", state, state->_memory_size) != MEMORY_ZONE_SUCCESS)
+    if (memory_zone_deallocate(MEMORY_ZONE_MODULES, state, state->_memory_size) != MEMORY_ZONE_SUCCESS)
         return INPUT_MODULE_ERROR_DEALLOCATION_FAILED;
 
     state = NULL;
@@ -273,7 +301,7 @@ InputModuleResult input_module_invoke_event(const InputEventCode code, const Voi
     if (!state) return INPUT_MODULE_ERROR_NOT_INITIALIZED;
     if (!state->_initialized) return INPUT_MODULE_ERROR_NOT_INITIALIZED;
 
-    if (delegate_unicast_invoke(event_code_names[code], sender, data) != DELEGATE_SUCCESS)
+    if (delegate_unicast_invoke_hashed(event_code_hashes[code], event_code_names[code], sender, data) != DELEGATE_SUCCESS)
         return INPUT_MODULE_ERROR_EVENT_INVOKE_FAILED;
 
     return INPUT_MODULE_SUCCESS;
@@ -294,7 +322,7 @@ InputModuleResult input_module_process_key_pressed(const InputKeyCode code, cons
                 ._key_code   = code,
             };
 
-            if (delegate_unicast_invoke(event_code_names[data_._event_code], NULL, &data_) != DELEGATE_SUCCESS)
+            if (delegate_unicast_invoke_hashed(event_code_hashes[data_._event_code], event_code_names[data_._event_code], NULL, &data_) != DELEGATE_SUCCESS)
                 return INPUT_MODULE_ERROR_EVENT_INVOKE_FAILED;
         }
     }
@@ -317,7 +345,7 @@ InputModuleResult input_module_process_mouse_pressed(const InputMouseCode code,
                 ._mouse_code = code,
             };
 
-            if (delegate_unicast_invoke(event_code_names[data_._event_code], NULL, &data_) != DELEGATE_SUCCESS)
+            if (delegate_unicast_invoke_hashed(event_code_hashes[data_._event_code], event_code_names[data_._event_code], NULL, &data_) != DELEGATE_SUCCESS)
                 return INPUT_MODULE_ERROR_EVENT_INVOKE_FAILED;
         }
     }
@@ -344,7 +372,7 @@ InputModuleResult input_module_process_mouse_moved(const Int32 x, const Int32 y)
                 ._y          = y,
             };
 
-            if (delegate_unicast_invoke(event_code_names[data_._event_code], NULL, &data_) != DELEGATE_SUCCESS)
+            if (delegate_unicast_invoke_hashed(event_code_hashes[data_._event_code], event_code_names[data_._event_code], NULL, &data_) != DELEGATE_SUCCESS)
                 return INPUT_MODULE_ERROR_EVENT_INVOKE_FAILED;
         }
     }
@@ -367,7 +395,7 @@ InputModuleResult input_module_process_mouse_scrolled(const Int8 scroll_value) {
                 ._scroll_value = scroll_value,
             };
 
-            if (delegate_unicast_invoke(event_code_names[data_._event_code], NULL, &data_) != DELEGATE_SUCCESS)
+            if (delegate_unicast_invoke_hashed(event_code_hashes[data_._event_code], event_code_names[data_._event_code], NULL, &data_) != DELEGATE_SUCCESS)
                 return INPUT_MODULE_ERROR_EVENT_INVOKE_FAILED;
         }
     }
@@ -49,41 +49,11 @@ void _window_module_callback_on_mouse_scrolled(VoidPtr context, Int8 scroll_valu
 
 // main ----------------------------------------------------------------- //
 
-WindowModuleResult window_module_startup(File *file) {
-    if (!file) return WINDOW_MODULE_ERROR_INVALID_PARAM;
-
-    // allocate window module state and configure its members
-    ByteSize alloc_size_ = 0;
-    if (memory_zone_allocate("modules", sizeof(WindowModuleState), (VoidPtr *)&state, &alloc_size_) != MEMORY_ZONE_SUCCESS)
-        return WINDOW_MODULE_ERROR_ALLOCATION_FAILED;
-    memset(state, 0, sizeof(WindowModuleState));
-    state->_memory_size = alloc_size_;
-
-    // handle default window properties - title
-    if (container_string_construct("vytal_engine", &state->_default_window_props._title) != CONTAINER_SUCCESS) {
-        if (memory_zone_deallocate("modules", state, state->_memory_size) != MEMORY_ZONE_SUCCESS)
-            return WINDOW_MODULE_ERROR_DEALLOCATION_FAILED;
-
-        return WINDOW_MODULE_ERROR_ALLOCATION_FAILED;
-    }
-
-    // handle default window properties - callbacks
-    {
-        WindowCallbacks callbacks_ = {
-            ._on_close          = _window_module_callback_on_window_close,
-            ._on_key_pressed    = _window_module_callback_on_key_pressed,
-            ._on_mouse_pressed  = _window_module_callback_on_mouse_pressed,
-            ._on_mouse_moved    = _window_module_callback_on_mouse_moved,
-            ._on_mouse_scrolled = _window_module_callback_on_mouse_scrolled,
-        };
-
-        state->_default_window_props._callbacks = callbacks_;
-    }
-
+// the section's lines, read into a line buffer the caller owns
+static WindowModuleResult _window_module_parse_section(File *file, Str line) {
     ByteSize seek_length_ = 0;
-    Str      line_        = calloc(1, LINE_BUFFER_MAX_SIZE);
-    while (platform_filesystem_read_line(file, &seek_length_, &line_) == FILE_SUCCESS) {
-        Str trimmed_ = line_;
+    while (platform_filesystem_read_line(file, &seek_length_, &line) == FILE_SUCCESS) {
+        Str trimmed_ = line;
 
         if (parse_trim_whitespace(&trimmed_) != PARSE_SUCCESS)
             return WINDOW_MODULE_ERROR_PARSE_FAILED;
@@ -172,14 +142,64 @@ WindowModuleResult window_module_startup(File *file) {
                 state->_default_window_props._backend = WINDOW_BACKEND_GLFW;
         }
     }
-    free(line_);
+
+    return WINDOW_MODULE_SUCCESS;
+}
+
+WindowModuleResult window_module_startup(File *file) {
+    if (!file) return WINDOW_MODULE_ERROR_INVALID_PARAM;
+
+    // allocate window module state and configure its members
+    ByteSize alloc_size_ = 0;
+    if (memory_zone_allocate(MEMORY_ZONE_MODULES, sizeof(WindowModuleState), (VoidPtr *)&state, &alloc_size_) != MEMORY_ZONE_SUCCESS)
+        return WINDOW_MODULE_ERROR_ALLOCATION_FAILED;
+    memset(state, 0, sizeof(WindowModuleState));
+    state->_memory_size = alloc_size_;
+
+    // handle default window properties - title
+    if (container_string_construct("vytal_engine", &state->_default_window_props._title) != CONTAINER_SUCCESS) {
+        if (memory_zone_deallocate(MEMORY_ZONE_MODULES, state, state->_memory_size) != MEMORY_ZONE_SUCCESS)
+            return WINDOW_MODULE_ERROR_DEALLOCATION_FAILED;
+
+        return WINDOW_MODULE_ERROR_ALLOCATION_FAILED;
+    }
+
+    // handle default window properties - callbacks
+    {
+        WindowCallbacks callbacks_ = {
+            ._on_close          = _window_module_callback_on_window_close,
+            ._on_key_pressed    = _window_module_callback_on_key_pressed,
+            ._on_mouse_pressed  = _window_module_callback_on_mouse_pressed,
+            ._on_mouse_moved    = _window_module_callback_on_mouse_moved,
+            ._on_mouse_scrolled = _window_module_callback_on_mouse_scrolled,
+        };
+
+        state->_default_window_props._callbacks = callbacks_;
+    }
+
+    // the line buffer only lives on the scratch stack while the section is parsed
+    MemoryZoneMarker scratch_marker_ = 0;
+    if (memory_zone_push_marker(MEMORY_ZONE_SCRATCH, &scratch_marker_) != MEMORY_ZONE_SUCCESS)
+        return WINDOW_MODULE_ERROR_ALLOCATION_FAILED;
+
+    Str                line_  = NULL;
+    WindowModuleResult parse_ = WINDOW_MODULE_ERROR_ALLOCATION_FAILED;
+
+    if (memory_zone_allocate(MEMORY_ZONE_SCRATCH, LINE_BUFFER_MAX_SIZE, (VoidPtr *)&line_, NULL) == MEMORY_ZONE_SUCCESS)
+        parse_ = _window_module_parse_section(file, line_);
+
+    // every way out of the parse comes through here, so the scratch stack is always popped back
+    if ((memory_zone_pop_to_marker(MEMORY_ZONE_SCRATCH, scratch_marker_) != MEMORY_ZONE_SUCCESS) && (parse_ == WINDOW_MODULE_SUCCESS))
+        parse_ = WINDOW_MODULE_ERROR_DEALLOCATION_FAILED;
+
+    if (parse_ != WINDOW_MODULE_SUCCESS) return parse_;
 
     // handle platform window system startup
     if (platform_window_startup(state->_default_window_props._backend) != WINDOW_SUCCESS) {
         if (container_string_destruct(state->_default_window_props._title) != CONTAINER_SUCCESS)
             return WINDOW_MODULE_ERROR_DEALLOCATION_FAILED;
 
-        if (memory_zone_deallocate("modules", state, state->_memory_size) != MEMORY_ZONE_SUCCESS)
+        if (memory_zone_deallocate(MEMORY_ZONE_MODULES, state, state->_memory_size) != MEMORY_ZONE_SUCCESS)
             return WINDOW_MODULE_ERROR_DEALLOCATION_FAILED;
 
         return WINDOW_MODULE_ERROR_ALLOCATION_FAILED;
@@ -205,7 +225,7 @@ WindowModuleResult window_module_shutdown(void) {
         memset(&state->_default_window_props, 0, sizeof(WindowProperties));
     }
 
-    if (memory_zone_deallocate("modules", state, state->_memory_size) != MEMORY_ZONE_SUCCESS)
+    if (memory_zone_deallocate(MEMORY_ZONE_MODULES, state, state->_memory_size) != MEMORY_ZONE_SUCCESS)
         return WINDOW_MODULE_ERROR_DEALLOCATION_FAILED;
 
     state = NULL;
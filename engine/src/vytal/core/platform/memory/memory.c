@@ -0,0 +1,102 @@
+#include "memory.h"
+
+#if defined(_WIN32)
+#    include <windows.h>
+#else
+#    include <sys/mman.h>
+#endif
+
+#if !defined(_WIN32)
+// reserves an over-sized range and trims it down to an aligned one, so transparent huge pages can back it
+VYTAL_INLINE VoidPtr _platform_memory_reserve_aligned(const ByteSize size, const ByteSize alignment) {
+    BytePtr addr_ = mmap(NULL, size + alignment, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+    if (addr_ == MAP_FAILED) return NULL;
+
+    // trim the misaligned head and the leftover tail
+    BytePtr aligned_ = (BytePtr)VYTAL_APPLY_ALIGNMENT((UIntPtr)addr_, alignment);
+    if (aligned_ > addr_) munmap(addr_, aligned_ - addr_);
+
+    ByteSize tail_ = (addr_ + size + alignment) - (aligned_ + size);
+    if (tail_) munmap(aligned_ + size, tail_);
+
+    return aligned_;
+}
+#endif
+
+PlatformMemoryResult platform_memory_reserve(const ByteSize size, const Bool huge_pages, VoidPtr *out_addr) {
+    if (!size || !out_addr) return PLATFORM_MEMORY_ERROR_INVALID_PARAM;
+
+#if defined(_WIN32)
+    // large pages need SeLockMemoryPrivilege and must be committed up front,
+    // so huge_pages is only a hint that windows does not take
+    (void)huge_pages;
+
+    *out_addr = VirtualAlloc(NULL, size, MEM_RESERVE, PAGE_NOACCESS);
+    return (*out_addr) ? PLATFORM_MEMORY_SUCCESS : PLATFORM_MEMORY_ERROR_RESERVE_FAILED;
+
+#else
+    if (!huge_pages) {
+        VoidPtr addr_ = mmap(NULL, size, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+        if (addr_ == MAP_FAILED) return PLATFORM_MEMORY_ERROR_RESERVE_FAILED;
+
+        *out_addr = addr_;
+        return PLATFORM_MEMORY_SUCCESS;
+    }
+
+    // explicit huge pages first (needs a configured hugetlb pool); no MAP_NORESERVE here,
+    // so an undersized pool fails now instead of faulting on first touch
+#    if defined(MAP_HUGETLB)
+    {
+        VoidPtr addr_ = mmap(NULL, size, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+        if (addr_ != MAP_FAILED) {
+            *out_addr = addr_;
+            return PLATFORM_MEMORY_SUCCESS;
+        }
+    }
+#    endif
+
+    // otherwise, fall back to transparent huge pages
+    VoidPtr addr_ = _platform_memory_reserve_aligned(size, PLATFORM_MEMORY_HUGE_PAGE_SIZE);
+    if (!addr_) return PLATFORM_MEMORY_ERROR_RESERVE_FAILED;
+
+#    if defined(MADV_HUGEPAGE)
+    madvise(addr_, size, MADV_HUGEPAGE);
+#    endif
+
+    *out_addr = addr_;
+    return PLATFORM_MEMORY_SUCCESS;
+#endif
+}
+
+PlatformMemoryResult platform_memory_release(VoidPtr addr, const ByteSize size) {
+    if (!addr || !size) return PLATFORM_MEMORY_ERROR_INVALID_PARAM;
+
+#if defined(_WIN32)
+    return VirtualFree(addr, 0, MEM_RELEASE) ? PLATFORM_MEMORY_SUCCESS : PLATFORM_MEMORY_ERROR_RELEASE_FAILED;
+#else
+    return (munmap(addr, size) == 0) ? PLATFORM_MEMORY_SUCCESS : PLATFORM_MEMORY_ERROR_RELEASE_FAILED;
+#endif
+}
+
+PlatformMemoryResult platform_memory_commit(VoidPtr addr, const ByteSize size) {
+    if (!addr || !size) return PLATFORM_MEMORY_ERROR_INVALID_PARAM;
+
+#if defined(_WIN32)
+    return VirtualAlloc(addr, size, MEM_COMMIT, PAGE_READWRITE) ? PLATFORM_MEMORY_SUCCESS : PLATFORM_MEMORY_ERROR_COMMIT_FAILED;
+#else
+    // pages are only backed on first touch, this just makes them accessible
+    return (mprotect(addr, size, PROT_READ | PROT_WRITE) == 0) ? PLATFORM_MEMORY_SUCCESS : PLATFORM_MEMORY_ERROR_COMMIT_FAILED;
+#endif
+}
+
+PlatformMemoryResult platform_memory_decommit(VoidPtr addr, const ByteSize size) {
+    if (!addr || !size) return PLATFORM_MEMORY_ERROR_INVALID_PARAM;
+
+#if defined(_WIN32)
+    return VirtualFree(addr, size, MEM_DECOMMIT) ? PLATFORM_MEMORY_SUCCESS : PLATFORM_MEMORY_ERROR_DECOMMIT_FAILED;
+#else
+    // hand the pages back (they read as zero if touched again), then fence the range off
+    if (madvise(addr, size, MADV_DONTNEED) != 0) return PLATFORM_MEMORY_ERROR_DECOMMIT_FAILED;
+    return (mprotect(addr, size, PROT_NONE) == 0) ? PLATFORM_MEMORY_SUCCESS : PLATFORM_MEMORY_ERROR_DECOMMIT_FAILED;
+#endif
+}
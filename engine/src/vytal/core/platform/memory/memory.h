@@ -0,0 +1,10 @@
+#pragma once
+
+#include "vytal/defines/core/memory.h"
+#include "vytal/defines/shared.h"
+
+VYTAL_API PlatformMemoryResult platform_memory_reserve(const ByteSize size, const Bool huge_pages, VoidPtr *out_addr);
+VYTAL_API PlatformMemoryResult platform_memory_release(VoidPtr addr, const ByteSize size);
+
+VYTAL_API PlatformMemoryResult platform_memory_commit(VoidPtr addr, const ByteSize size);
+VYTAL_API PlatformMemoryResult platform_memory_decommit(VoidPtr addr, const ByteSize size);
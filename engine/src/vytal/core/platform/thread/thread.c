@@ -0,0 +1,70 @@
+#include "thread.h"
+
+#if defined(_WIN32)
+#    include <windows.h>
+#else
+#    include <pthread.h>
+#    include <sched.h>
+#endif
+
+#if defined(_WIN32)
+static DWORD WINAPI _platform_thread_entry(LPVOID thread) {
+    ((PlatformThread *)thread)->_func(((PlatformThread *)thread)->_arg);
+    return 0;
+}
+#else
+static VoidPtr _platform_thread_entry(VoidPtr thread) {
+    ((PlatformThread *)thread)->_func(((PlatformThread *)thread)->_arg);
+    return NULL;
+}
+#endif
+
+PlatformThreadResult platform_thread_create(PlatformThread *thread, PlatformThreadFunc func, VoidPtr arg) {
+    if (!thread || !func) return PLATFORM_THREAD_ERROR_INVALID_PARAM;
+
+    thread->_func    = func;
+    thread->_arg     = arg;
+    thread->_started = false;
+
+#if defined(_WIN32)
+    HANDLE handle_ = CreateThread(NULL, 0, _platform_thread_entry, thread, 0, NULL);
+    if (!handle_) return PLATFORM_THREAD_ERROR_CREATE_FAILED;
+
+    thread->_handle = (UIntPtr)handle_;
+
+#else
+    pthread_t handle_;
+    if (pthread_create(&handle_, NULL, _platform_thread_entry, thread) != 0) return PLATFORM_THREAD_ERROR_CREATE_FAILED;
+
+    thread->_handle = (UIntPtr)handle_;
+#endif
+
+    thread->_started = true;
+    return PLATFORM_THREAD_SUCCESS;
+}
+
+PlatformThreadResult platform_thread_join(PlatformThread *thread) {
+    if (!thread) return PLATFORM_THREAD_ERROR_INVALID_PARAM;
+    if (!thread->_started) return PLATFORM_THREAD_ERROR_NOT_STARTED;
+
+    thread->_started = false;
+
+#if defined(_WIN32)
+    HANDLE handle_ = (HANDLE)thread->_handle;
+    Bool   joined_ = (WaitForSingleObject(handle_, INFINITE) == WAIT_OBJECT_0);
+
+    CloseHandle(handle_);
+    return joined_ ? PLATFORM_THREAD_SUCCESS : PLATFORM_THREAD_ERROR_JOIN_FAILED;
+
+#else
+    return (pthread_join((pthread_t)thread->_handle, NULL) == 0) ? PLATFORM_THREAD_SUCCESS : PLATFORM_THREAD_ERROR_JOIN_FAILED;
+#endif
+}
+
+void platform_thread_yield(void) {
+#if defined(_WIN32)
+    SwitchToThread();
+#else
+    sched_yield();
+#endif
+}
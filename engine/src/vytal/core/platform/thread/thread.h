@@ -0,0 +1,10 @@
+#pragma once
+
+#include "vytal/defines/core/thread.h"
+#include "vytal/defines/shared.h"
+
+VYTAL_API PlatformThreadResult platform_thread_create(PlatformThread *thread, PlatformThreadFunc func, VoidPtr arg);
+VYTAL_API PlatformThreadResult platform_thread_join(PlatformThread *thread);
+
+// gives the rest of the time slice to another ready thread, for waits too long to spin through
+VYTAL_API void platform_thread_yield(void);
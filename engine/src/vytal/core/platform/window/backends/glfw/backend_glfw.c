@@ -92,7 +92,7 @@ WindowResult window_backend_glfw_construct_handle(
         return WINDOW_ERROR_NOT_INITIALIZED;
 
     ByteSize alloc_size_ = 0;
-    if (memory_zone_allocate("platform", sizeof(struct Window_Handle), (VoidPtr *)out_new_window, &alloc_size_) != MEMORY_ZONE_SUCCESS)
+    if (memory_zone_allocate(MEMORY_ZONE_PLATFORM, sizeof(struct Window_Handle), (VoidPtr *)out_new_window, &alloc_size_) != MEMORY_ZONE_SUCCESS)
         return WINDOW_ERROR_ALLOCATION_FAILED;
     memset((*out_new_window), 0, sizeof(struct Window_Handle));
     (*out_new_window)->_memory_size = alloc_size_;
@@ -130,7 +130,7 @@ WindowResult window_backend_glfw_destruct_handle(Window window) {
     if (!backend_glfw_initialized) return WINDOW_ERROR_NOT_INITIALIZED;
 
     if (window->_handle) glfwDestroyWindow(window->_handle);
-    if (memory_zone_deallocate("platform", window, window->_memory_size) != MEMORY_ZONE_SUCCESS)
+    if (memory_zone_deallocate(MEMORY_ZONE_PLATFORM, window, window->_memory_size) != MEMORY_ZONE_SUCCESS)
         return WINDOW_ERROR_ALLOCATION_FAILED;
 
     window = NULL;
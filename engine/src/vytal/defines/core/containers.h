@@ -17,10 +17,55 @@ typedef enum Container_Result {
     CONTAINER_ERROR_MAP_KEY_ALREADY_EXISTS     = -100,
     CONTAINER_ERROR_MAP_KEY_NOT_FOUND          = -101,
     CONTAINER_ERROR_MAP_REACHED_PROBING_LIMITS = -102,
+
+    // ring container specifics
+    CONTAINER_ERROR_RING_FULL = -200,
 } ContainerResult;
 
 // types ---------------------------------------------------------------- //
 
-typedef struct Container_String *String;
-typedef struct Container_Map    *Map;
-typedef struct Container_Array  *Array;
+typedef struct Container_String         *String;
+typedef struct Container_Map            *Map;
+typedef struct Container_Id_Map         *IdMap;
+typedef struct Container_Ordered_Map    *OrderedMap;
+typedef struct Container_Concurrent_Map *ConcurrentMap;
+typedef struct Container_Array          *Array;
+typedef struct Container_SoA            *SoA;
+typedef struct Container_Spsc_Ring      *SpscRing;
+typedef struct Container_Mpmc_Ring      *MpmcRing;
+
+// walks the live entries only; _index is where the walk stands, _key and _data belong to the container
+typedef struct Container_Map_Iterator {
+    ByteSize _index;
+    ConstStr _key;
+    VoidPtr  _data;
+} MapIterator;
+
+typedef struct Container_Id_Map_Iterator {
+    ByteSize _index;
+    UInt64   _key;
+    VoidPtr  _data;
+} IdMapIterator;
+
+// a single column of a SoA container: _size elements of _data_size bytes, starting on a CONTAINER_SOA_ALIGNMENT
+// boundary and padded up to the next one, so a kernel may run whole vectors over the tail
+typedef struct Container_SoA_Column_View {
+    VoidPtr  _data;
+    ByteSize _data_size;
+    ByteSize _size;
+} SoAColumnView;
+
+#if !defined(CONTAINER_SOA_ALIGNMENT)
+#    define CONTAINER_SOA_ALIGNMENT 64
+#endif
+
+// sort keys ------------------------------------------------------------ //
+
+typedef enum Container_Sort_Key {
+    CONTAINER_SORT_KEY_UINT32,
+    CONTAINER_SORT_KEY_UINT64,
+    CONTAINER_SORT_KEY_INT32,
+    CONTAINER_SORT_KEY_INT64,
+    CONTAINER_SORT_KEY_FLT32,
+    CONTAINER_SORT_KEY_FLT64,
+} ContainerSortKey;
@@ -8,4 +8,33 @@ typedef UInt64 HashedInt;
 
 // hashed modes --------------------------------------------------------- //
 
-typedef enum Hash_Mode { HASH_MODE_XX64 } HashMode;
+typedef enum Hash_Mode { HASH_MODE_XX64, HASH_MODE_FNV1A64 } HashMode;
+
+// compile-time hashing ------------------------------------------------- //
+
+#define HASH_FNV1A64_OFFSET 14695981039346656037ull
+#define HASH_FNV1A64_PRIME 1099511628211ull
+#define HASH_LITERAL_MAX_LENGTH 64
+
+// one FNV-1a round over the i-th character; rounds past the end leave the hash as it is
+#define _HASH_LITERAL_STEP(str, i, hash)                                                                     \
+    (((hash) ^ (UInt8)(((i) < sizeof(str) - 1) ? (str)[((i) < sizeof(str) - 1) ? (i) : 0] : 0)) * \
+     (((i) < sizeof(str) - 1) ? HASH_FNV1A64_PRIME : 1ull))
+
+#define _HASH_LITERAL_4(str, i, hash) \
+    _HASH_LITERAL_STEP(str, (i) + 3, _HASH_LITERAL_STEP(str, (i) + 2, _HASH_LITERAL_STEP(str, (i) + 1, _HASH_LITERAL_STEP(str, i, hash))))
+#define _HASH_LITERAL_16(str, i, hash) \
+    _HASH_LITERAL_4(str, (i) + 12, _HASH_LITERAL_4(str, (i) + 8, _HASH_LITERAL_4(str, (i) + 4, _HASH_LITERAL_4(str, i, hash))))
+#define _HASH_LITERAL_64(str, hash) \
+    _HASH_LITERAL_16(str, 48, _HASH_LITERAL_16(str, 32, _HASH_LITERAL_16(str, 16, _HASH_LITERAL_16(str, 0, hash))))
+
+// FNV-1a of a string literal, equal to hash_str(str, HASH_MODE_FNV1A64); a constant expression,
+// so it can initialize static tables (longer literals fail to compile)
+#define HASH_LITERAL(str) \
+    ((HashedInt)_HASH_LITERAL_64(str, HASH_FNV1A64_OFFSET) + 0 * sizeof(Char[(sizeof(str) - 1 <= HASH_LITERAL_MAX_LENGTH) ? 1 : -1]))
+
+// the same, but folded once per call site even in unoptimized builds
+#define HASH_LITERAL_ONCE(str) ({                    \
+    static const HashedInt _hash = HASH_LITERAL(str); \
+    _hash;                                            \
+})
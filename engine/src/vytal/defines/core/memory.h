@@ -2,30 +2,228 @@
 
 #include "types.h"
 
+// bit-flag operations -------------------------------------------------- //
+
+#define VYTAL_BITFLAG_FIELD(bit) (1 << bit)
+#define VYTAL_BITFLAG_TOGGLE(flags, bitmask) (flags ^= (bitmask))
+#define VYTAL_BITFLAG_SET(flags, bitmask) (flags |= (bitmask))
+#define VYTAL_BITFLAG_CLEAR(flags, bitmask) (flags &= ~(bitmask))
+#define VYTAL_BITFLAG_IF_SET(flags, bitmask) (flags & (bitmask))
+#define VYTAL_BITFLAG_IF_ALL_SET(flags, bitmask) ((flags & (bitmask)) == (bitmask))
+#define VYTAL_BITFLAG_IF_NOT_SET(flags, bitmask) (!bitflag_if_set(flags, bitmask))
+
+// handles -------------------------------------------------------------- //
+
+// built-in zones are interned at compile time from the [memory_zones] keys;
+// any other configured zone is given a handle past MEMORY_ZONE_BUILTIN_COUNT
+// and resolved once through memory_zone_get_handle()
+typedef enum Memory_Zone_Handle {
+    MEMORY_ZONE_INVALID = -1,
+
+    MEMORY_ZONE_CORE = 0,
+    MEMORY_ZONE_MODULES,
+    MEMORY_ZONE_CONTAINERS,
+    MEMORY_ZONE_STRINGS,
+    MEMORY_ZONE_DELEGATES,
+    MEMORY_ZONE_INPUT,
+    MEMORY_ZONE_PLATFORM,
+    MEMORY_ZONE_ASSETS,
+    MEMORY_ZONE_RENDERER,
+    MEMORY_ZONE_FRAME,
+    MEMORY_ZONE_SCRATCH,
+    MEMORY_ZONE_DELEGATE_HANDLES,
+
+    MEMORY_ZONE_BUILTIN_COUNT
+} MemoryZoneHandle;
+
+// flags ---------------------------------------------------------------- //
+
+// declared per zone after the capacity, e.g. assets = "256MB" -> concurrent
+typedef enum Memory_Zone_Flag {
+    MEMORY_ZONE_FLAG_NONE,
+    MEMORY_ZONE_FLAG_CONCURRENT = VYTAL_BITFLAG_FIELD(0),
+    MEMORY_ZONE_FLAG_COALESCE   = VYTAL_BITFLAG_FIELD(1),
+    MEMORY_ZONE_FLAG_RESERVE    = VYTAL_BITFLAG_FIELD(2),  // own address range, committed as the zone fills up
+    MEMORY_ZONE_FLAG_HUGE_PAGES = VYTAL_BITFLAG_FIELD(3),  // implies reserve
+    MEMORY_ZONE_FLAG_GROWABLE   = VYTAL_BITFLAG_FIELD(4)   // chains new chunks once full, e.g. -> grow or -> grow:1GB
+} MemoryZoneFlag;
+
+// zone types ----------------------------------------------------------- //
+
+// picked like a flag, e.g. frame = "4MB" -> frame_arena,
+// except pools, which are declared by their layout, e.g. nodes = "1024 x 64"
+typedef enum Memory_Zone_Type {
+    MEMORY_ZONE_TYPE_GENERAL,      // jemalloc-spaced size classes over a bump region
+    MEMORY_ZONE_TYPE_FRAME_ARENA,  // double-buffered bump region, reset every frame
+    MEMORY_ZONE_TYPE_STACK,        // LIFO bump region, rolled back to pushed markers
+    MEMORY_ZONE_TYPE_POOL          // pre-carved fixed-size slots
+} MemoryZoneType;
+
+// stack zones: bump offset to roll back to
+typedef ByteSize MemoryZoneMarker;
+
+// pool zones: slot index (low 32 bits) and the slot's generation (high 32 bits)
+typedef UInt64 MemoryZonePoolHandle;
+
+// captured zone state, rolled back to with memory_zone_restore()
+typedef struct Memory_Zone_Snapshot *MemoryZoneSnapshot;
+
 // types ---------------------------------------------------------------- //
 
 typedef struct Memory_Zone_Size_Class {
-    VoidPtr *_blocks;
+    VoidPtr  _free_list;  // intrusive, freed blocks hold their own links
     ByteSize _size;
     ByteSize _num_blocks;
-    ByteSize _capacity;
+
+    // guards the shared free list of concurrent zones
+    volatile Int32 _lock;
+
+    // running counters (VYTAL_MEMORY_STATS builds only)
+    ByteSize _live_blocks;
+    ByteSize _peak_blocks;
+    ByteSize _requested_memory;
+    ByteSize _num_allocations;
+    ByteSize _num_deallocations;
 } MemoryZoneSizeClass;
 
+typedef struct Memory_Zone_Pool {
+    ByteSize _slot_size;
+    ByteSize _slot_count;
+    ByteSize _num_free;
+
+    UInt32 *_free_slots;   // stack of free slot indices
+    UInt32 *_generations;  // bumped every time a slot is released
+    UInt64 *_live_slots;   // bitmap, for walking live objects
+} MemoryZonePool;
+
+// extra memory chained to a full zone; the header sits in front of its payload
+typedef struct Memory_Zone_Chunk {
+    struct Memory_Zone_Chunk *_next;  // previously chained chunk
+    ByteSize                  _size;  // mapped bytes, header included
+    ByteSize                  _capacity;
+    ByteSize                  _bump_offset;
+} MemoryZoneChunk;
+
+// address range of a freed guarded block, reserved but no longer committed
+typedef struct Memory_Zone_Guard_Range {
+    VoidPtr  _addr;
+    ByteSize _size;
+} MemoryZoneGuardRange;
+
+// freed guarded ranges each zone holds on to before handing the oldest back
+#if !defined(MEMORY_ZONE_GUARD_QUARANTINE)
+#    define MEMORY_ZONE_GUARD_QUARANTINE 32
+#endif
+
 typedef struct Memory_Zone {
-    ConstStr _name;
-    VoidPtr  _start_addr;
+    ConstStr       _name;
+    VoidPtr        _start_addr;
+    MemoryZoneType _type;
+    MemoryZoneFlag _flags;
 
     ByteSize _used_memory;
+    ByteSize _bump_offset;
+    ByteSize _tail_size;     // block right below the bump pointer (coalescing zones)
+    ByteSize _dirty_offset;  // everything below was handed out at some point, everything above is still zero
     ByteSize _capacity;
 
     MemoryZoneSizeClass *_size_classes;
     ByteSize             _num_classes;
+
+    // per-thread magazines in front of the size-class free lists (concurrent zones only)
+    VoidPtr _thread_caches;
+
+    // half of the region being bumped this frame (frame arenas only)
+    ByteSize _frame_index;
+
+    // slot bookkeeping (pools only)
+    MemoryZonePool _pool;
+
+    // committed prefix of the reserved address range (reserved zones only)
+    ByteSize       _reserved_size;
+    ByteSize       _committed;
+    volatile Int32 _commit_lock;
+
+    // chunks chained past _capacity, newest first (growable zones only)
+    MemoryZoneChunk *_chunks;
+    ByteSize         _grown_capacity;
+    ByteSize         _max_capacity;  // 0 grows without bound
+    volatile Int32   _grow_lock;
+
+    // blocks past the last size class, one chunk each (growable zones only, counted in _grown_capacity)
+    MemoryZoneChunk *_oversized_chunks;
+
+    // live blocks, newest first (VYTAL_MEMORY_DEBUG builds, general zones only)
+    VoidPtr        _debug_blocks;
+    volatile Int32 _debug_lock;
+
+    // bytes mapped for live guarded blocks, charged against the region (or the grow cap), and the
+    // freed guarded ranges kept reserved so late accesses still fault (VYTAL_MEMORY_DEBUG builds only)
+    ByteSize             _guarded_memory;
+    MemoryZoneGuardRange _guard_quarantine[MEMORY_ZONE_GUARD_QUARANTINE];
+    ByteSize             _guard_quarantine_next;  // oldest entry, released once the ring is full
+
+    // high-water marks
+    ByteSize _peak_used_memory;
+    ByteSize _peak_capacity;
+
+    // running counters (VYTAL_MEMORY_STATS builds only)
+    ByteSize _requested_memory;
+    ByteSize _num_allocations;
+    ByteSize _num_deallocations;
+    ByteSize _frame_allocations;  // during the last completed frame
+    ByteSize _frame_deallocations;
+    ByteSize _frame_start_allocations;
+    ByteSize _frame_start_deallocations;
 } MemoryZone;
 
+// statistics ----------------------------------------------------------- //
+
+typedef struct Memory_Zone_Stats {
+    ByteSize _capacity;          // configured plus grown
+    ByteSize _used_memory;       // live bytes, rounded up to what the zone hands out
+    ByteSize _requested_memory;  // live bytes as asked for (general zones and pools)
+    ByteSize _peak_used_memory;
+    ByteSize _peak_capacity;
+    ByteSize _num_allocations;
+    ByteSize _num_deallocations;
+    ByteSize _frame_allocations;  // during the last completed frame
+    ByteSize _frame_deallocations;
+    ByteSize _num_size_classes;
+    Flt32    _fragmentation;  // share of used memory lost to rounding
+} MemoryZoneStats;
+
+typedef struct Memory_Zone_Size_Class_Stats {
+    ByteSize _size;
+    ByteSize _live_blocks;
+    ByteSize _peak_blocks;
+    ByteSize _free_blocks;
+    ByteSize _requested_memory;
+    ByteSize _num_allocations;
+    ByteSize _num_deallocations;
+} MemoryZoneSizeClassStats;
+
+// allocations attributed to the line that made them (VYTAL_MEMORY_TRACK_CALLSITES builds only)
+typedef struct Memory_Zone_Callsite_Stats {
+    ConstStr         _file;
+    Int32            _line;
+    MemoryZoneHandle _zone;
+    ByteSize         _num_allocations;
+    ByteSize         _allocated_memory;
+} MemoryZoneCallsiteStats;
+
+#if defined(VYTAL_MEMORY_TRACK_CALLSITES) && !defined(MEMORY_ZONE_CALLSITE_SLOTS)
+#    define MEMORY_ZONE_CALLSITE_SLOTS 1024
+#endif
+
+// blocks of at least this size get their own mapping with a guard behind them (VYTAL_MEMORY_DEBUG builds only, 0 disables)
+#if defined(VYTAL_MEMORY_DEBUG) && !defined(MEMORY_ZONE_GUARD_PAGE_THRESHOLD)
+#    define MEMORY_ZONE_GUARD_PAGE_THRESHOLD 65536
+#endif
+
 typedef struct Memory_Manager {
     MemoryZone *_zones;
     ByteSize    _zone_count;
-    ByteSize    _used_memory;
     ByteSize    _capacity;
     VoidPtr     _pool;
 } MemoryManager;
@@ -44,13 +242,23 @@ typedef enum Memory_Manager_Result {
     MEMORY_MANAGER_ERROR_PARSE_FAILED                    = -8
 } MemoryManagerResult;
 
+typedef enum Platform_Memory_Result {
+    PLATFORM_MEMORY_SUCCESS               = 0,
+    PLATFORM_MEMORY_ERROR_INVALID_PARAM   = -1,
+    PLATFORM_MEMORY_ERROR_RESERVE_FAILED  = -2,
+    PLATFORM_MEMORY_ERROR_RELEASE_FAILED  = -3,
+    PLATFORM_MEMORY_ERROR_COMMIT_FAILED   = -4,
+    PLATFORM_MEMORY_ERROR_DECOMMIT_FAILED = -5
+} PlatformMemoryResult;
+
 typedef enum Memory_Zone_Result {
     MEMORY_ZONE_SUCCESS                   = 0,
     MEMORY_ZONE_ERROR_NOT_EXIST           = -1,
     MEMORY_ZONE_ERROR_INVALID_PARAM       = -2,
     MEMORY_ZONE_ERROR_INSUFFICIENT_MEMORY = -3,
     MEMORY_ZONE_ERROR_INVALID_POINTER     = -4,
-    MEMORY_ZONE_ERROR_MEMORY_ALLOCATION   = -5
+    MEMORY_ZONE_ERROR_MEMORY_ALLOCATION   = -5,
+    MEMORY_ZONE_ERROR_CORRUPTED           = -6
 } MemoryZoneResult;
 
 // endian-check --------------------------------------------------------- //
@@ -96,16 +304,6 @@ VT_INLINE Int32 check_endianness(void) {
          (((x) & 0x000000000000ff00ULL) << 40) | (((x) & 0x00000000000000ffULL) << 56))
 #endif
 
-// bit-flag operations -------------------------------------------------- //
-
-#define VYTAL_BITFLAG_FIELD(bit) (1 << bit)
-#define VYTAL_BITFLAG_TOGGLE(flags, bitmask) (flags ^= (bitmask))
-#define VYTAL_BITFLAG_SET(flags, bitmask) (flags |= (bitmask))
-#define VYTAL_BITFLAG_CLEAR(flags, bitmask) (flags &= ~(bitmask))
-#define VYTAL_BITFLAG_IF_SET(flags, bitmask) (flags & (bitmask))
-#define VYTAL_BITFLAG_IF_ALL_SET(flags, bitmask) ((flags & (bitmask)) == (bitmask))
-#define VYTAL_BITFLAG_IF_NOT_SET(flags, bitmask) (!bitflag_if_set(flags, bitmask))
-
 // memory alignment ----------------------------------------------------- //
 
 #define VYTAL_APPLY_ALIGNMENT(size, alignment) (((size) + (alignment - 1)) & ~(alignment - 1))
@@ -115,3 +313,10 @@ VT_INLINE Int32 check_endianness(void) {
 #define KB_IN_BYTES(kb) ((kb) * 1024)
 #define MB_IN_BYTES(mb) ((mb) * 1024 * 1024)
 #define GB_IN_BYTES(gb) ((gb) * 1024 * 1024 * 1024)
+
+// page sizes ----------------------------------------------------------- //
+
+#define PLATFORM_MEMORY_HUGE_PAGE_SIZE MB_IN_BYTES(2)
+
+// reserved zones commit their address range in steps of this size
+#define MEMORY_ZONE_COMMIT_GRANULARITY(flags) (VYTAL_BITFLAG_IF_SET(flags, MEMORY_ZONE_FLAG_HUGE_PAGES) ? PLATFORM_MEMORY_HUGE_PAGE_SIZE : MEMORY_ZONE_COMMIT_SIZE)
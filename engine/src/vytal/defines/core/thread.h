@@ -0,0 +1,25 @@
+#pragma once
+
+#include "types.h"
+
+// return codes --------------------------------------------------------- //
+
+typedef enum Platform_Thread_Result {
+    PLATFORM_THREAD_SUCCESS              = 0,
+    PLATFORM_THREAD_ERROR_INVALID_PARAM  = -1,
+    PLATFORM_THREAD_ERROR_CREATE_FAILED  = -2,
+    PLATFORM_THREAD_ERROR_JOIN_FAILED    = -3,
+    PLATFORM_THREAD_ERROR_NOT_STARTED    = -4,
+} PlatformThreadResult;
+
+// types ---------------------------------------------------------------- //
+
+typedef void (*PlatformThreadFunc)(VoidPtr arg);
+
+// owned by the caller and must outlive the thread, which reads _func and _arg from it
+typedef struct Platform_Thread {
+    UIntPtr            _handle;
+    PlatformThreadFunc _func;
+    VoidPtr            _arg;
+    Bool               _started;
+} PlatformThread;
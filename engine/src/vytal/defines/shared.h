@@ -34,6 +34,16 @@
 
 #endif
 
+// thread-local storage ------------------------------------------------ //
+
+#if defined(_MSC_VER)
+#    define VYTAL_THREAD_LOCAL __declspec(thread)
+
+#else
+#    define VYTAL_THREAD_LOCAL _Thread_local
+
+#endif
+
 // stack array size ----------------------------------------------------- //
 
 #define VYTAL_ARRAY_SIZE(array) (sizeof(array) / sizeof(*array))
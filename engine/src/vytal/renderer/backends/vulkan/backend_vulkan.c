@@ -50,7 +50,7 @@ RendererBackendResult renderer_backend_vulkan_startup(Window *out_first_window,
     // allocate renderer backend
     ByteSize total_size_ = sizeof(struct Renderer_Backend) + sizeof(RendererBackendVulkanContext);
     ByteSize alloc_size_ = 0;
-    if (memory_zone_allocate("renderer", total_size_, (VoidPtr *)out_backend, &alloc_size_) != MEMORY_ZONE_SUCCESS)
+    if (memory_zone_allocate(MEMORY_ZONE_RENDERER, total_size_, (VoidPtr *)out_backend, &alloc_size_) != MEMORY_ZONE_SUCCESS)
         return RENDERER_BACKEND_ERROR_ALLOCATION_FAILED;
     memset(*out_backend, 0, alloc_size_);
 
@@ -251,7 +251,7 @@ RendererBackendResult renderer_backend_vulkan_shutdown(RendererBackend backend)
     }
 
     // renderer backend
-    if (memory_zone_deallocate("renderer", backend, backend->_memory_size) != MEMORY_ZONE_SUCCESS)
+    if (memory_zone_deallocate(MEMORY_ZONE_RENDERER, backend, backend->_memory_size) != MEMORY_ZONE_SUCCESS)
         return RENDERER_BACKEND_ERROR_DEALLOCATION_FAILED;
     backend = NULL;
 
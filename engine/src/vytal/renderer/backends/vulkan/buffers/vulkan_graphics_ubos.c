@@ -19,10 +19,10 @@ RendererBackendResult renderer_backend_vulkan_graphics_ubos_construct(const Void
     Window                        window_      = (Window)(*out_window);
     VkDeviceSize                  buffer_size_ = sizeof(UniformBufferObject);
 
-    if (memory_zone_allocate("renderer", sizeof(RendererBuffer) * window_->_render_context._swapchain_image_count, (VoidPtr *)&window_->_render_context._graphics_ubos, NULL) != MEMORY_ZONE_SUCCESS)
+    if (memory_zone_allocate(MEMORY_ZONE_RENDERER, sizeof(RendererBuffer) * window_->_render_context._swapchain_image_count, (VoidPtr *)&window_->_render_context._graphics_ubos, NULL) != MEMORY_ZONE_SUCCESS)
         return RENDERER_BACKEND_ERROR_VULKAN_GRAPHICS_UBOS_CONSTRUCT_FAILED;
 
-    if (memory_zone_allocate("renderer", sizeof(VoidPtr) * window_->_render_context._swapchain_image_count, (VoidPtr *)&window_->_render_context._graphics_ubos_mapped, NULL) != MEMORY_ZONE_SUCCESS)
+    if (memory_zone_allocate(MEMORY_ZONE_RENDERER, sizeof(VoidPtr) * window_->_render_context._swapchain_image_count, (VoidPtr *)&window_->_render_context._graphics_ubos_mapped, NULL) != MEMORY_ZONE_SUCCESS)
         return RENDERER_BACKEND_ERROR_VULKAN_GRAPHICS_UBOS_CONSTRUCT_FAILED;
 
     for (ByteSize i = 0; i < window_->_render_context._swapchain_image_count; ++i) {
@@ -66,10 +66,10 @@ RendererBackendResult renderer_backend_vulkan_graphics_ubos_destruct(const VoidP
             return destruct_buffer_;
     }
 
-    if (memory_zone_deallocate("renderer", window_->_render_context._graphics_ubos, sizeof(RendererBuffer) * window_->_render_context._swapchain_image_count) != MEMORY_ZONE_SUCCESS)
+    if (memory_zone_deallocate(MEMORY_ZONE_RENDERER, window_->_render_context._graphics_ubos, sizeof(RendererBuffer) * window_->_render_context._swapchain_image_count) != MEMORY_ZONE_SUCCESS)
         return RENDERER_BACKEND_ERROR_VULKAN_GRAPHICS_UBOS_DESTRUCT_FAILED;
 
-    if (memory_zone_deallocate("renderer", window_->_render_context._graphics_ubos_mapped, sizeof(VoidPtr) * window_->_render_context._swapchain_image_count) != MEMORY_ZONE_SUCCESS)
+    if (memory_zone_deallocate(MEMORY_ZONE_RENDERER, window_->_render_context._graphics_ubos_mapped, sizeof(VoidPtr) * window_->_render_context._swapchain_image_count) != MEMORY_ZONE_SUCCESS)
         return RENDERER_BACKEND_ERROR_VULKAN_GRAPHICS_UBOS_DESTRUCT_FAILED;
 
     return RENDERER_BACKEND_SUCCESS;
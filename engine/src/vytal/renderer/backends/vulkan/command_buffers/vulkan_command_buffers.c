@@ -29,7 +29,7 @@ RendererBackendResult renderer_backend_vulkan_graphics_command_buffers_construct
     RendererBackendVulkanContext *context_ = (RendererBackendVulkanContext *)context;
     Window                        window_  = (Window)(*out_window);
 
-    if (memory_zone_allocate("renderer", sizeof(VkCommandBuffer) * window_->_render_context._graphics_in_flight_fence_count, (VoidPtr *)&window_->_render_context._graphics_cmd_buffers, NULL) != MEMORY_ZONE_SUCCESS)
+    if (memory_zone_allocate(MEMORY_ZONE_RENDERER, sizeof(VkCommandBuffer) * window_->_render_context._graphics_in_flight_fence_count, (VoidPtr *)&window_->_render_context._graphics_cmd_buffers, NULL) != MEMORY_ZONE_SUCCESS)
         return RENDERER_BACKEND_ERROR_VULKAN_COMMAND_BUFFERS_ALLOCATE_FAILED;
 
     VkCommandBufferAllocateInfo alloc_info_ = {
@@ -63,7 +63,7 @@ RendererBackendResult renderer_backend_vulkan_graphics_command_buffers_destruct(
         window_->_render_context._graphics_in_flight_fence_count,
         window_->_render_context._graphics_cmd_buffers);
 
-    if (memory_zone_deallocate("renderer", window_->_render_context._graphics_cmd_buffers, sizeof(VkCommandBuffer) * window_->_render_context._graphics_in_flight_fence_count) != MEMORY_ZONE_SUCCESS)
+    if (memory_zone_deallocate(MEMORY_ZONE_RENDERER, window_->_render_context._graphics_cmd_buffers, sizeof(VkCommandBuffer) * window_->_render_context._graphics_in_flight_fence_count) != MEMORY_ZONE_SUCCESS)
         return RENDERER_BACKEND_ERROR_VULKAN_COMMAND_BUFFERS_DEALLOCATE_FAILED;
 
     return RENDERER_BACKEND_SUCCESS;
@@ -20,7 +20,7 @@ RendererBackendResult renderer_backend_vulkan_descriptor_set_layouts_construct(V
 
     // compute descriptor set layout
     {
-        if (memory_zone_allocate("renderer", sizeof(DescriptorSetLayout) * MAX_COMPUTE_PIPELINES, (VoidPtr *)&context_->_compute_desc_set_layouts, NULL) != MEMORY_ZONE_SUCCESS)
+        if (memory_zone_allocate(MEMORY_ZONE_RENDERER, sizeof(DescriptorSetLayout) * MAX_COMPUTE_PIPELINES, (VoidPtr *)&context_->_compute_desc_set_layouts, NULL) != MEMORY_ZONE_SUCCESS)
             return RENDERER_BACKEND_ERROR_VULKAN_DESCRIPTOR_SET_LAYOUTS_CONSTRUCT_FAILED;
         memset(context_->_compute_desc_set_layouts, 0, sizeof(DescriptorSetLayout) * MAX_COMPUTE_PIPELINES);
     }
@@ -100,7 +100,7 @@ RendererBackendResult renderer_backend_vulkan_descriptor_set_layouts_destruct(Vo
             layout_->_handle = VK_NULL_HANDLE;
         }
 
-        if (memory_zone_deallocate("renderer", context_->_compute_desc_set_layouts, sizeof(DescriptorSetLayout) * MAX_COMPUTE_PIPELINES) != MEMORY_ZONE_SUCCESS)
+        if (memory_zone_deallocate(MEMORY_ZONE_RENDERER, context_->_compute_desc_set_layouts, sizeof(DescriptorSetLayout) * MAX_COMPUTE_PIPELINES) != MEMORY_ZONE_SUCCESS)
             return RENDERER_BACKEND_ERROR_VULKAN_DESCRIPTOR_SET_LAYOUTS_DESTRUCT_FAILED;
         context_->_compute_desc_set_layouts = NULL;
     }
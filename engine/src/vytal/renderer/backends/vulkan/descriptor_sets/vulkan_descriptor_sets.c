@@ -19,7 +19,7 @@ RendererBackendResult renderer_backend_vulkan_descriptor_sets_construct(const Vo
     RendererBackendVulkanContext *context_ = (RendererBackendVulkanContext *)context;
     Window                        window_  = (Window)*out_window;
 
-    if (memory_zone_allocate("renderer", sizeof(DescriptorSet) * window_->_render_context._graphics_in_flight_fence_count, (VoidPtr *)&window_->_render_context._graphics_desc_sets, NULL) != MEMORY_ZONE_SUCCESS)
+    if (memory_zone_allocate(MEMORY_ZONE_RENDERER, sizeof(DescriptorSet) * window_->_render_context._graphics_in_flight_fence_count, (VoidPtr *)&window_->_render_context._graphics_desc_sets, NULL) != MEMORY_ZONE_SUCCESS)
         return RENDERER_BACKEND_ERROR_VULKAN_DESCRIPTOR_SETS_CONSTRUCT_FAILED;
 
     for (ByteSize i = 0; i < window_->_render_context._graphics_in_flight_fence_count; ++i) {
@@ -97,7 +97,7 @@ RendererBackendResult renderer_backend_vulkan_descriptor_sets_destruct(const Voi
             vkFreeDescriptorSets(context_->_device, window_->_render_context._graphics_desc_pool, 1, &window_->_render_context._graphics_desc_sets[i]._handle);
     }
 
-    if (memory_zone_deallocate("renderer", window_->_render_context._graphics_desc_sets, sizeof(DescriptorSet) * window_->_render_context._graphics_in_flight_fence_count) != MEMORY_ZONE_SUCCESS)
+    if (memory_zone_deallocate(MEMORY_ZONE_RENDERER, window_->_render_context._graphics_desc_sets, sizeof(DescriptorSet) * window_->_render_context._graphics_in_flight_fence_count) != MEMORY_ZONE_SUCCESS)
         return RENDERER_BACKEND_ERROR_VULKAN_DESCRIPTOR_SETS_DESTRUCT_FAILED;
 
     return RENDERER_BACKEND_SUCCESS;
@@ -17,7 +17,7 @@ RendererBackendResult renderer_backend_vulkan_framebuffers_construct(const VoidP
     RendererBackendVulkanContext *context_ = (RendererBackendVulkanContext *)context;
     Window                        window_  = (Window)(*out_window);
 
-    if (memory_zone_allocate("renderer", sizeof(VkFramebuffer) * window_->_render_context._swapchain_image_count, (VoidPtr *)&window_->_render_context._framebuffers, NULL) != MEMORY_ZONE_SUCCESS)
+    if (memory_zone_allocate(MEMORY_ZONE_RENDERER, sizeof(VkFramebuffer) * window_->_render_context._swapchain_image_count, (VoidPtr *)&window_->_render_context._framebuffers, NULL) != MEMORY_ZONE_SUCCESS)
         return RENDERER_BACKEND_ERROR_ALLOCATION_FAILED;
 
     for (ByteSize i = 0; i < window_->_render_context._swapchain_image_count; ++i) {
@@ -40,7 +40,7 @@ RendererBackendResult renderer_backend_vulkan_framebuffers_construct(const VoidP
         };
 
         if (vkCreateFramebuffer(context_->_device, &framebuf_info_, NULL, &window_->_render_context._framebuffers[i]) != VK_SUCCESS) {
-            if (memory_zone_deallocate("renderer", window_->_render_context._framebuffers, sizeof(VkFramebuffer) * window_->_render_context._swapchain_image_count) != MEMORY_ZONE_SUCCESS)
+            if (memory_zone_deallocate(MEMORY_ZONE_RENDERER, window_->_render_context._framebuffers, sizeof(VkFramebuffer) * window_->_render_context._swapchain_image_count) != MEMORY_ZONE_SUCCESS)
                 return RENDERER_BACKEND_ERROR_DEALLOCATION_FAILED;
 
             return RENDERER_BACKEND_ERROR_VULKAN_FRAMEBUFFERS_CONSTRUCT_FAILED;
@@ -60,7 +60,7 @@ RendererBackendResult renderer_backend_vulkan_framebuffers_destruct(const VoidPt
             vkDestroyFramebuffer(context_->_device, window_->_render_context._framebuffers[i], NULL);
     }
 
-    if (memory_zone_deallocate("renderer", window_->_render_context._framebuffers, sizeof(VkFramebuffer) * window_->_render_context._swapchain_image_count) != MEMORY_ZONE_SUCCESS)
+    if (memory_zone_deallocate(MEMORY_ZONE_RENDERER, window_->_render_context._framebuffers, sizeof(VkFramebuffer) * window_->_render_context._swapchain_image_count) != MEMORY_ZONE_SUCCESS)
         return RENDERER_BACKEND_ERROR_DEALLOCATION_FAILED;
 
     return RENDERER_BACKEND_SUCCESS;
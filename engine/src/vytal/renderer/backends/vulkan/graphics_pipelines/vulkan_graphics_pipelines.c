@@ -22,10 +22,10 @@ RendererBackendResult renderer_backend_vulkan_graphics_pipelines_construct(const
     Char                          vert_filepath_[LINE_BUFFER_MAX_SIZE * 2] = {0};
     Char                          frag_filepath_[LINE_BUFFER_MAX_SIZE * 2] = {0};
 
-    if (memory_zone_allocate("renderer", sizeof(VkPipelineLayout) * NUM_GRAPHICS_PIPELINES, (VoidPtr *)&window_->_render_context._graphics_pipeline_layouts, NULL) != MEMORY_ZONE_SUCCESS)
+    if (memory_zone_allocate(MEMORY_ZONE_RENDERER, sizeof(VkPipelineLayout) * NUM_GRAPHICS_PIPELINES, (VoidPtr *)&window_->_render_context._graphics_pipeline_layouts, NULL) != MEMORY_ZONE_SUCCESS)
         return RENDERER_BACKEND_ERROR_VULKAN_GRAPHICS_PIPELINE_CONSTRUCT_FAILED;
 
-    if (memory_zone_allocate("renderer", sizeof(VkPipeline) * NUM_GRAPHICS_PIPELINES, (VoidPtr *)&window_->_render_context._graphics_pipelines, NULL) != MEMORY_ZONE_SUCCESS)
+    if (memory_zone_allocate(MEMORY_ZONE_RENDERER, sizeof(VkPipeline) * NUM_GRAPHICS_PIPELINES, (VoidPtr *)&window_->_render_context._graphics_pipelines, NULL) != MEMORY_ZONE_SUCCESS)
         return RENDERER_BACKEND_ERROR_VULKAN_GRAPHICS_PIPELINE_CONSTRUCT_FAILED;
 
     VkVertexInputBindingDescription vertex_input_bindings_[] = {
@@ -204,10 +204,10 @@ RendererBackendResult renderer_backend_vulkan_graphics_pipelines_destruct(const
             return destruct_pipeline_;
     }
 
-    if (memory_zone_deallocate("renderer", window_->_render_context._graphics_pipeline_layouts, sizeof(VkPipelineLayout) * NUM_GRAPHICS_PIPELINES) != MEMORY_ZONE_SUCCESS)
+    if (memory_zone_deallocate(MEMORY_ZONE_RENDERER, window_->_render_context._graphics_pipeline_layouts, sizeof(VkPipelineLayout) * NUM_GRAPHICS_PIPELINES) != MEMORY_ZONE_SUCCESS)
         return RENDERER_BACKEND_ERROR_VULKAN_GRAPHICS_PIPELINE_DESTRUCT_FAILED;
 
-    if (memory_zone_deallocate("renderer", window_->_render_context._graphics_pipelines, sizeof(VkPipeline) * NUM_GRAPHICS_PIPELINES) != MEMORY_ZONE_SUCCESS)
+    if (memory_zone_deallocate(MEMORY_ZONE_RENDERER, window_->_render_context._graphics_pipelines, sizeof(VkPipeline) * NUM_GRAPHICS_PIPELINES) != MEMORY_ZONE_SUCCESS)
         return RENDERER_BACKEND_ERROR_VULKAN_GRAPHICS_PIPELINE_DESTRUCT_FAILED;
 
     return RENDERER_BACKEND_SUCCESS;
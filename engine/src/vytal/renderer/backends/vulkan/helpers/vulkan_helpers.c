@@ -155,12 +155,19 @@ RendererBackendResult renderer_backend_vulkan_helpers_construct_shader_module(
     if (!context || !shader_filepath || !out_shader_module) return RENDERER_BACKEND_ERROR_INVALID_PARAM;
     RendererBackendVulkanContext *context_ = (RendererBackendVulkanContext *)context;
 
+    // shader code is only needed until the module is created
+    MemoryZoneMarker scratch_marker_ = 0;
+    if (memory_zone_push_marker(MEMORY_ZONE_SCRATCH, &scratch_marker_) != MEMORY_ZONE_SUCCESS)
+        return RENDERER_BACKEND_ERROR_ALLOCATION_FAILED;
+
     ByteSize shader_code_size_ = 0;
     UInt32  *shader_code_      = NULL;
 
     RendererBackendResult read_shader_file_ = renderer_backend_vulkan_helpers_read_shader_file(shader_filepath, &shader_code_size_, &shader_code_);
-    if (read_shader_file_ != RENDERER_BACKEND_SUCCESS)
+    if (read_shader_file_ != RENDERER_BACKEND_SUCCESS) {
+        memory_zone_pop_to_marker(MEMORY_ZONE_SCRATCH, scratch_marker_);
         return read_shader_file_;
+    }
 
     VkShaderModuleCreateInfo module_info_ = {
         .sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO,
@@ -169,10 +176,12 @@ RendererBackendResult renderer_backend_vulkan_helpers_construct_shader_module(
         .pCode    = shader_code_,
     };
 
-    if (vkCreateShaderModule(context_->_device, &module_info_, NULL, out_shader_module) != VK_SUCCESS)
+    VkResult create_module_ = vkCreateShaderModule(context_->_device, &module_info_, NULL, out_shader_module);
+    memory_zone_pop_to_marker(MEMORY_ZONE_SCRATCH, scratch_marker_);
+
+    if (create_module_ != VK_SUCCESS)
         return RENDERER_BACKEND_ERROR_VULKAN_SHADER_MODULE_CONSTRUCT_FAILED;
 
-    free(shader_code_);
     return RENDERER_BACKEND_SUCCESS;
 }
 
@@ -639,7 +648,7 @@ RendererBackendResult renderer_backend_vulkan_helpers_construct_texture(
         if (texture_filepath)
             stbi_image_free(pixels_);
         else {
-            if (memory_zone_deallocate("renderer", pixels_, image_size_) != MEMORY_ZONE_SUCCESS)
+            if (memory_zone_deallocate(MEMORY_ZONE_RENDERER, pixels_, image_size_) != MEMORY_ZONE_SUCCESS)
                 return RENDERER_BACKEND_ERROR_DEALLOCATION_FAILED;
         }
     }
@@ -985,7 +994,7 @@ RendererBackendResult renderer_backend_vulkan_helpers_begin_single_time_commands
     if (!context || !pool || !cmd_buffer_count || !out_buffers) return RENDERER_BACKEND_ERROR_INVALID_PARAM;
     RendererBackendVulkanContext *context_ = (RendererBackendVulkanContext *)context;
 
-    if (memory_zone_allocate("renderer", sizeof(VkCommandBuffer) * cmd_buffer_count, (VoidPtr *)out_buffers, NULL) != MEMORY_ZONE_SUCCESS)
+    if (memory_zone_allocate(MEMORY_ZONE_RENDERER, sizeof(VkCommandBuffer) * cmd_buffer_count, (VoidPtr *)out_buffers, NULL) != MEMORY_ZONE_SUCCESS)
         return RENDERER_BACKEND_ERROR_VULKAN_HELPERS_BEGIN_SINGLE_TIME_COMMANDS_FAILED;
 
     VkCommandBufferAllocateInfo alloc_info_ = {
@@ -998,7 +1007,7 @@ RendererBackendResult renderer_backend_vulkan_helpers_begin_single_time_commands
     };
 
     if (vkAllocateCommandBuffers(context_->_device, &alloc_info_, (*out_buffers)) != VK_SUCCESS) {
-        if (memory_zone_deallocate("renderer", (*out_buffers), sizeof(VkCommandBuffer) * cmd_buffer_count) != MEMORY_ZONE_SUCCESS)
+        if (memory_zone_deallocate(MEMORY_ZONE_RENDERER, (*out_buffers), sizeof(VkCommandBuffer) * cmd_buffer_count) != MEMORY_ZONE_SUCCESS)
             return RENDERER_BACKEND_ERROR_DEALLOCATION_FAILED;
 
         return RENDERER_BACKEND_ERROR_VULKAN_HELPERS_BEGIN_SINGLE_TIME_COMMANDS_FAILED;
@@ -1050,7 +1059,7 @@ RendererBackendResult renderer_backend_vulkan_helpers_end_single_time_commands(
 
     // when done, deallocate the command buffers
     vkFreeCommandBuffers(context_->_device, *pool, cmd_buffer_count, buffers);
-    if (memory_zone_deallocate("renderer", buffers, sizeof(VkCommandBuffer) * cmd_buffer_count) != MEMORY_ZONE_SUCCESS)
+    if (memory_zone_deallocate(MEMORY_ZONE_RENDERER, buffers, sizeof(VkCommandBuffer) * cmd_buffer_count) != MEMORY_ZONE_SUCCESS)
         return RENDERER_BACKEND_ERROR_DEALLOCATION_FAILED;
 
     return RENDERER_BACKEND_SUCCESS;
@@ -1066,9 +1075,18 @@ RendererBackendResult renderer_backend_vulkan_helpers_read_shader_file(
     if (platform_filesystem_open_file(&file_, filepath, FILE_IO_MODE_READ, FILE_MODE_BINARY) != FILE_SUCCESS)
         return RENDERER_BACKEND_ERROR_VULKAN_HELPERS_SHADER_FILE_OPEN_FAILED;
 
-    if (platform_filesystem_read_binary_uint32(&file_, out_shader_size, out_shader_code) != FILE_SUCCESS)
+    // spir-v is a stream of 32-bit words
+    ByteSize file_size_ = platform_filesystem_file_size(&file_);
+    if (!file_size_ || (file_size_ % sizeof(UInt32) != 0))
+        return RENDERER_BACKEND_ERROR_VULKAN_HELPERS_SHADER_FILE_READ_FAILED;
+
+    // scratch memory, released by the caller's marker
+    if (memory_zone_allocate(MEMORY_ZONE_SCRATCH, file_size_, (VoidPtr *)out_shader_code, NULL) != MEMORY_ZONE_SUCCESS)
+        return RENDERER_BACKEND_ERROR_ALLOCATION_FAILED;
+
+    if (platform_filesystem_read_data(&file_, file_size_, *out_shader_code) != FILE_SUCCESS)
         return RENDERER_BACKEND_ERROR_VULKAN_HELPERS_SHADER_FILE_READ_FAILED;
-    *out_shader_size *= sizeof(UInt32);
+    *out_shader_size = file_size_;
 
     if (platform_filesystem_close_file(&file_) != FILE_SUCCESS)
         return RENDERER_BACKEND_ERROR_VULKAN_HELPERS_SHADER_FILE_CLOSE_FAILED;
@@ -1080,7 +1098,7 @@ RendererBackendResult renderer_backend_vulkan_helpers_construct_default_texture(
     if (!out_default_texture) return RENDERER_BACKEND_ERROR_INVALID_PARAM;
     ByteSize image_size_ = DEFAULT_TEXTURE_WIDTH * DEFAULT_TEXTURE_HEIGHT * 4;
 
-    if (memory_zone_allocate("renderer", image_size_, (VoidPtr *)out_default_texture, NULL) != MEMORY_ZONE_SUCCESS)
+    if (memory_zone_allocate(MEMORY_ZONE_RENDERER, image_size_, (VoidPtr *)out_default_texture, NULL) != MEMORY_ZONE_SUCCESS)
         return RENDERER_BACKEND_ERROR_VULKAN_HELPERS_CONSTRUCT_DEFAULT_TEXTURE_FAILED;
 
     UInt32 *texture_ = (UInt32 *)(*out_default_texture);
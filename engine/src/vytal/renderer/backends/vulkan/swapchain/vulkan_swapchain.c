@@ -159,7 +159,7 @@ RendererBackendResult renderer_backend_vulkan_swapchain_construct(const VoidPtr
 
         window_->_render_context._swapchain_image_count = swapchain_image_count_;
 
-        if (memory_zone_allocate("renderer", sizeof(VkImage) * swapchain_image_count_, (VoidPtr *)&window_->_render_context._swapchain_images, NULL) != MEMORY_ZONE_SUCCESS)
+        if (memory_zone_allocate(MEMORY_ZONE_RENDERER, sizeof(VkImage) * swapchain_image_count_, (VoidPtr *)&window_->_render_context._swapchain_images, NULL) != MEMORY_ZONE_SUCCESS)
             return RENDERER_BACKEND_ERROR_VULKAN_SWAPCHAIN_CONSTRUCT_FAILED;
 
         if (vkGetSwapchainImagesKHR(context_->_device, window_->_render_context._curr_swapchain, &swapchain_image_count_, window_->_render_context._swapchain_images) != VK_SUCCESS)
@@ -211,7 +211,7 @@ RendererBackendResult renderer_backend_vulkan_swapchain_cleanup(const VoidPtr co
             vkDestroyImageView(context_->_device, window_->_render_context._swapchain_image_views[i], NULL);
     }
 
-    if (memory_zone_deallocate("renderer", window_->_render_context._swapchain_images, sizeof(VkImage) * window_->_render_context._swapchain_image_count) != MEMORY_ZONE_SUCCESS)
+    if (memory_zone_deallocate(MEMORY_ZONE_RENDERER, window_->_render_context._swapchain_images, sizeof(VkImage) * window_->_render_context._swapchain_image_count) != MEMORY_ZONE_SUCCESS)
         return RENDERER_BACKEND_ERROR_VULKAN_SWAPCHAIN_CONSTRUCT_FAILED;
 
     return RENDERER_BACKEND_SUCCESS;
@@ -228,7 +228,7 @@ RendererBackendResult renderer_backend_vulkan_swapchain_destruct(const VoidPtr c
     if (window_->_render_context._prev_swapchain != VK_NULL_HANDLE)
         vkDestroySwapchainKHR(context_->_device, window_->_render_context._prev_swapchain, NULL);
 
-    if (memory_zone_deallocate("renderer", window_->_render_context._swapchain_images, sizeof(VkImage) * window_->_render_context._swapchain_image_count) != MEMORY_ZONE_SUCCESS)
+    if (memory_zone_deallocate(MEMORY_ZONE_RENDERER, window_->_render_context._swapchain_images, sizeof(VkImage) * window_->_render_context._swapchain_image_count) != MEMORY_ZONE_SUCCESS)
         return RENDERER_BACKEND_ERROR_VULKAN_SWAPCHAIN_IMAGE_VIEWS_CONSTRUCT_FAILED;
 
     return RENDERER_BACKEND_SUCCESS;
@@ -239,7 +239,7 @@ RendererBackendResult renderer_backend_vulkan_swapchain_construct_image_views(co
     RendererBackendVulkanContext *context_ = (RendererBackendVulkanContext *)context;
     Window                        window_  = (Window)(*out_window);
 
-    if (memory_zone_allocate("renderer", sizeof(VkImageView) * window_->_render_context._swapchain_image_count, (VoidPtr *)&window_->_render_context._swapchain_image_views, NULL) != MEMORY_ZONE_SUCCESS)
+    if (memory_zone_allocate(MEMORY_ZONE_RENDERER, sizeof(VkImageView) * window_->_render_context._swapchain_image_count, (VoidPtr *)&window_->_render_context._swapchain_image_views, NULL) != MEMORY_ZONE_SUCCESS)
         return RENDERER_BACKEND_ERROR_VULKAN_SWAPCHAIN_CONSTRUCT_FAILED;
 
     for (ByteSize i = 0; i < window_->_render_context._swapchain_image_count; ++i) {
@@ -269,7 +269,7 @@ RendererBackendResult renderer_backend_vulkan_swapchain_destruct_image_views(con
             return destruct_image_view_;
     }
 
-    if (memory_zone_deallocate("renderer", window_->_render_context._swapchain_image_views, sizeof(VkImageView) * window_->_render_context._swapchain_image_count) != MEMORY_ZONE_SUCCESS)
+    if (memory_zone_deallocate(MEMORY_ZONE_RENDERER, window_->_render_context._swapchain_image_views, sizeof(VkImageView) * window_->_render_context._swapchain_image_count) != MEMORY_ZONE_SUCCESS)
         return RENDERER_BACKEND_ERROR_VULKAN_SWAPCHAIN_DESTRUCT_FAILED;
 
     return RENDERER_BACKEND_SUCCESS;
@@ -41,13 +41,13 @@ RendererBackendResult renderer_backend_vulkan_graphics_sync_resources_construct(
 
     window_->_render_context._graphics_in_flight_fence_count = window_->_render_context._swapchain_image_count;
 
-    if (memory_zone_allocate("renderer", sizeof(VkFence) * window_->_render_context._graphics_in_flight_fence_count, (VoidPtr *)&window_->_render_context._graphics_in_flight_fences, NULL) != MEMORY_ZONE_SUCCESS)
+    if (memory_zone_allocate(MEMORY_ZONE_RENDERER, sizeof(VkFence) * window_->_render_context._graphics_in_flight_fence_count, (VoidPtr *)&window_->_render_context._graphics_in_flight_fences, NULL) != MEMORY_ZONE_SUCCESS)
         return RENDERER_BACKEND_ERROR_VULKAN_SYNC_RESOURCES_CONSTRUCT_FAILED;
 
-    if (memory_zone_allocate("renderer", sizeof(VkSemaphore) * window_->_render_context._graphics_in_flight_fence_count, (VoidPtr *)&window_->_render_context._graphics_image_available_semaphores, NULL) != MEMORY_ZONE_SUCCESS)
+    if (memory_zone_allocate(MEMORY_ZONE_RENDERER, sizeof(VkSemaphore) * window_->_render_context._graphics_in_flight_fence_count, (VoidPtr *)&window_->_render_context._graphics_image_available_semaphores, NULL) != MEMORY_ZONE_SUCCESS)
         return RENDERER_BACKEND_ERROR_VULKAN_SYNC_RESOURCES_CONSTRUCT_FAILED;
 
-    if (memory_zone_allocate("renderer", sizeof(VkSemaphore) * window_->_render_context._graphics_in_flight_fence_count, (VoidPtr *)&window_->_render_context._graphics_render_complete_semaphores, NULL) != MEMORY_ZONE_SUCCESS)
+    if (memory_zone_allocate(MEMORY_ZONE_RENDERER, sizeof(VkSemaphore) * window_->_render_context._graphics_in_flight_fence_count, (VoidPtr *)&window_->_render_context._graphics_render_complete_semaphores, NULL) != MEMORY_ZONE_SUCCESS)
         return RENDERER_BACKEND_ERROR_VULKAN_SYNC_RESOURCES_CONSTRUCT_FAILED;
 
     for (ByteSize i = 0; i < window_->_render_context._graphics_in_flight_fence_count; ++i) {
@@ -86,13 +86,13 @@ RendererBackendResult renderer_backend_vulkan_graphics_sync_resources_destruct(c
             vkDestroyFence(context_->_device, window_->_render_context._graphics_in_flight_fences[i], NULL);
     }
 
-    if (memory_zone_deallocate("renderer", window_->_render_context._graphics_render_complete_semaphores, sizeof(VkSemaphore) * window_->_render_context._graphics_in_flight_fence_count) != MEMORY_ZONE_SUCCESS)
+    if (memory_zone_deallocate(MEMORY_ZONE_RENDERER, window_->_render_context._graphics_render_complete_semaphores, sizeof(VkSemaphore) * window_->_render_context._graphics_in_flight_fence_count) != MEMORY_ZONE_SUCCESS)
         return RENDERER_BACKEND_ERROR_VULKAN_SYNC_RESOURCES_DESTRUCT_FAILED;
 
-    if (memory_zone_deallocate("renderer", window_->_render_context._graphics_image_available_semaphores, sizeof(VkSemaphore) * window_->_render_context._graphics_in_flight_fence_count) != MEMORY_ZONE_SUCCESS)
+    if (memory_zone_deallocate(MEMORY_ZONE_RENDERER, window_->_render_context._graphics_image_available_semaphores, sizeof(VkSemaphore) * window_->_render_context._graphics_in_flight_fence_count) != MEMORY_ZONE_SUCCESS)
         return RENDERER_BACKEND_ERROR_VULKAN_SYNC_RESOURCES_DESTRUCT_FAILED;
 
-    if (memory_zone_deallocate("renderer", window_->_render_context._graphics_in_flight_fences, sizeof(VkFence) * window_->_render_context._graphics_in_flight_fence_count) != MEMORY_ZONE_SUCCESS)
+    if (memory_zone_deallocate(MEMORY_ZONE_RENDERER, window_->_render_context._graphics_in_flight_fences, sizeof(VkFence) * window_->_render_context._graphics_in_flight_fence_count) != MEMORY_ZONE_SUCCESS)
         return RENDERER_BACKEND_ERROR_VULKAN_SYNC_RESOURCES_DESTRUCT_FAILED;
 
     return RENDERER_BACKEND_SUCCESS;
@@ -18,21 +18,11 @@ typedef struct Renderer_Module_State {
 
 static RendererModuleState *state = NULL;
 
-RendererModuleResult renderer_module_startup(File *file, Window *out_first_window) {
-    if (!file) return RENDERER_MODULE_ERROR_INVALID_PARAM;
-    if (state) return RENDERER_MODULE_ERROR_ALREADY_INITIALIZED;
-
-    ByteSize alloc_size_ = 0;
-    if (memory_zone_allocate("modules", sizeof(RendererModuleState), (VoidPtr *)&state, &alloc_size_) != MEMORY_ZONE_SUCCESS)
-        return RENDERER_MODULE_ERROR_ALLOCATION_FAILED;
-    memset(state, 0, alloc_size_);
-
-    RendererBackendType backend_type_ = 0;
-
+// the section's lines, read into a line buffer the caller owns
+static RendererModuleResult _renderer_module_parse_section(File *file, Str line, RendererBackendType *out_backend_type) {
     ByteSize seek_length_ = 0;
-    Str      line_        = calloc(1, LINE_BUFFER_MAX_SIZE);
-    while (platform_filesystem_read_line(file, &seek_length_, &line_) == FILE_SUCCESS) {
-        Str trimmed_ = line_;
+    while (platform_filesystem_read_line(file, &seek_length_, &line) == FILE_SUCCESS) {
+        Str trimmed_ = line;
 
         if (parse_trim_whitespace(&trimmed_) != PARSE_SUCCESS)
             return RENDERER_MODULE_ERROR_PARSE_FAILED;
@@ -51,7 +41,7 @@ RendererModuleResult renderer_module_startup(File *file, Window *out_first_windo
 
         if (!strcmp(key_, "backend")) {
             if (!strcmp(value_, "vulkan"))
-                backend_type_ = RENDERER_BACKEND_VULKAN;
+                *out_backend_type = RENDERER_BACKEND_VULKAN;
             else
                 continue;
         }
@@ -59,10 +49,40 @@ RendererModuleResult renderer_module_startup(File *file, Window *out_first_windo
         else if (!strcmp(key_, "shaders_path"))
             memcpy(state->_shaders_filepath, value_, LINE_BUFFER_MAX_SIZE);
     }
-    free(line_);
+
+    return RENDERER_MODULE_SUCCESS;
+}
+
+RendererModuleResult renderer_module_startup(File *file, Window *out_first_window) {
+    if (!file) return RENDERER_MODULE_ERROR_INVALID_PARAM;
+    if (state) return RENDERER_MODULE_ERROR_ALREADY_INITIALIZED;
+
+    ByteSize alloc_size_ = 0;
+    if (memory_zone_allocate(MEMORY_ZONE_MODULES, sizeof(RendererModuleState), (VoidPtr *)&state, &alloc_size_) != MEMORY_ZONE_SUCCESS)
+        return RENDERER_MODULE_ERROR_ALLOCATION_FAILED;
+    memset(state, 0, alloc_size_);
+
+    RendererBackendType backend_type_ = 0;
+
+    // the line buffer only lives on the scratch stack while the section is parsed
+    MemoryZoneMarker scratch_marker_ = 0;
+    if (memory_zone_push_marker(MEMORY_ZONE_SCRATCH, &scratch_marker_) != MEMORY_ZONE_SUCCESS)
+        return RENDERER_MODULE_ERROR_ALLOCATION_FAILED;
+
+    Str                  line_  = NULL;
+    RendererModuleResult parse_ = RENDERER_MODULE_ERROR_ALLOCATION_FAILED;
+
+    if (memory_zone_allocate(MEMORY_ZONE_SCRATCH, LINE_BUFFER_MAX_SIZE, (VoidPtr *)&line_, NULL) == MEMORY_ZONE_SUCCESS)
+        parse_ = _renderer_module_parse_section(file, line_, &backend_type_);
+
+    // every way out of the parse comes through here, so the scratch stack is always popped back
+    if ((memory_zone_pop_to_marker(MEMORY_ZONE_SCRATCH, scratch_marker_) != MEMORY_ZONE_SUCCESS) && (parse_ == RENDERER_MODULE_SUCCESS))
+        parse_ = RENDERER_MODULE_ERROR_DEALLOCATION_FAILED;
+
+    if (parse_ != RENDERER_MODULE_SUCCESS) return parse_;
 
     if (renderer_backend_startup(backend_type_, out_first_window, state->_shaders_filepath, &state->_backend) != RENDERER_BACKEND_SUCCESS) {
-        if (memory_zone_deallocate("modules", state, alloc_size_) != MEMORY_ZONE_SUCCESS)
+        if (memory_zone_deallocate(MEMORY_ZONE_MODULES, state, alloc_size_) != MEMORY_ZONE_SUCCESS)
             return RENDERER_MODULE_ERROR_DEALLOCATION_FAILED;
 
         return RENDERER_MODULE_ERROR_ALLOCATION_FAILED;
@@ -81,7 +101,7 @@ RendererModuleResult renderer_module_shutdown(void) {
         return RENDERER_MODULE_ERROR_DEALLOCATION_FAILED;
     state->_backend = NULL;
 
-    if (memory_zone_deallocate("modules", state, state->_memory_size) != MEMORY_ZONE_SUCCESS)
+    if (memory_zone_deallocate(MEMORY_ZONE_MODULES, state, state->_memory_size) != MEMORY_ZONE_SUCCESS)
         return RENDERER_MODULE_ERROR_DEALLOCATION_FAILED;
     state = NULL;
 